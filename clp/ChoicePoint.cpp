@@ -40,6 +40,7 @@ ChoicePoint::clear()
     _revTogglesIdx = 0;
     _revAllocationsIdx = 0;
     _revActionsIdx = 0;
+    _revSpansIdx = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,6 +199,13 @@ public:
     {
         return _revActionsIdx;
     }
+
+    /** Get rev-spans index. */
+    uint_t
+    revSpansIdx() const
+    {
+        return _revSpansIdx;
+    }
     //@}
 
     /// \name Accessors (non-const)
@@ -300,6 +307,13 @@ public:
     {
         _revActionsIdx = revActionsIdx;
     }
+
+    /** Set rev-spans index. */
+    void
+    setRevSpansIdx(uint_t revSpansIdx)
+    {
+        _revSpansIdx = revSpansIdx;
+    }
     //@}
 
 private:
@@ -326,6 +340,7 @@ private:
     uint_t _revTogglesIdx;
     uint_t _revAllocationsIdx;
     uint_t _revActionsIdx;
+    uint_t _revSpansIdx;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
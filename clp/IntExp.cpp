@@ -307,6 +307,23 @@ IntExp::remove(int min, int max)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+IntExp::removeIntersectExp(IntExp* exp)
+{
+    uint_t size = _intersectExps.size();
+    for (uint_t idx = 0; idx != size; ++idx)
+    {
+        if (_intersectExps[idx] == exp)
+        {
+            _intersectExps.remove(idx);
+            return;
+        }
+    }
+    ASSERTD(false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 IntExp::raiseEvents()
 {
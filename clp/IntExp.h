@@ -313,6 +313,9 @@ public:
         _intersectExps.add(exp);
     }
 
+    /** Undo addIntersectExp. */
+    void removeIntersectExp(IntExp* exp);
+
     /**
        Changes in this IntExp's domain will invalidate the given bound.
        \see Bound::invalidate
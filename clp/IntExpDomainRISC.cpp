@@ -307,12 +307,10 @@ IntExpDomainRISC::addRange(int min, int max)
             findPrevForward(spanMax + 1, prev);
             span->saveState(mgr());
             span->setMax(minAdd - 1);
-            auto newSpan = new IntSpan(minAdd, maxAdd, 1, 0);
-            mgr()->revAllocate(newSpan);
+            auto newSpan = IntSpan::revNew(mgr(), minAdd, maxAdd, 1, 0);
             insertAfter(newSpan, prev);
             findPrevForward(maxAdd + 1, prev);
-            newSpan = new IntSpan(maxAdd + 1, spanMax, 0, 0);
-            mgr()->revAllocate(newSpan);
+            newSpan = IntSpan::revNew(mgr(), maxAdd + 1, spanMax, 0, 0);
             insertAfter(newSpan, prev);
         }
 #ifdef DEBUG_UNIT
@@ -571,12 +569,10 @@ IntExpDomainRISC::removeRange(int min, int max)
             findPrevForward(spanMax + 1, prev);
             span->saveState(mgr());
             span->setMax(min - 1);
-            IntSpan* newSpan = new IntSpan(min, max, 0, 0);
-            mgr()->revAllocate(newSpan);
+            IntSpan* newSpan = IntSpan::revNew(mgr(), min, max, 0, 0);
             insertAfter(newSpan, prev);
             findPrevForward(max + 1, prev);
-            newSpan = new IntSpan(max + 1, spanMax, 1, 0);
-            mgr()->revAllocate(newSpan);
+            newSpan = IntSpan::revNew(mgr(), max + 1, spanMax, 1, 0);
             insertAfter(newSpan, prev);
         }
 #ifdef DEBUG_UNIT
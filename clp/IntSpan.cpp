@@ -1,5 +1,6 @@
 #include "libclp.h"
 #include "IntSpan.h"
+#include "IntSpanPool.h"
 #include "Manager.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +24,10 @@ CLP_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static_assert(sizeof(IntSpan) <= IntSpanPool::slotSize, "IntSpan doesn't fit in a pool slot");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 IntSpan::IntSpan(int min, int max, uint_t v0, uint_t v1, uint_t level)
 {
     init();
@@ -38,6 +43,28 @@ IntSpan::IntSpan(int min, int max, uint_t v0, uint_t v1, uint_t level)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#undef new
+
+IntSpan*
+IntSpan::revNew(Manager* mgr, int min, int max, uint_t v0, uint_t v1)
+{
+    auto span = new (mgr->intSpanPool()->allocate()) IntSpan(min, max, v0, v1);
+    mgr->revAllocateSpan(span);
+    return span;
+}
+
+#include <libutl/gblnew_macros.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+IntSpan*
+IntSpan::revClone(Manager* mgr) const
+{
+    return revNew(mgr, _min, _max, _v0, _v1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 IntSpan::copy(const Object& rhs)
 {
@@ -80,13 +107,13 @@ IntSpan::canMergeWith(const IntSpan* rhs) const
 void
 IntSpan::setLevel(uint_t level)
 {
-    if (_next != nullptr)
+    if (_next != _nextInline)
     {
         delete[] _next;
     }
     _level = level;
     uint_t num = level + 1;
-    _next = new IntSpan*[num];
+    _next = (num <= CLP_INTSPAN_INLINEDEPTH) ? _nextInline : new IntSpan*[num];
     memset(_next, 0, num * sizeof(IntSpan*));
 }
 
@@ -120,7 +147,8 @@ IntSpan::init()
 
     _stateDepth = 0;
     _prev = nullptr;
-    _next = nullptr;
+    _next = _nextInline;
+    memset(_nextInline, 0, CLP_INTSPAN_INLINEDEPTH * sizeof(IntSpan*));
     _level = 0;
 }
 
@@ -129,8 +157,10 @@ IntSpan::init()
 void
 IntSpan::deInit()
 {
-    ASSERTD(_next != nullptr);
-    delete[] _next;
+    if (_next != _nextInline)
+    {
+        delete[] _next;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define CLP_INTSPAN_MAXDEPTH 20U
+#define CLP_INTSPAN_INLINEDEPTH 2U
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -27,7 +28,13 @@ class Manager;
 
    RevIntSpanCol stores IntSpan objects in a skip-list.  To support that, an IntSpan has
    a \c prev pointer (pointing to the previous IntSpan at level 0), and an array of \c next
-   pointers that link to the next IntSpan at each level of the node.
+   pointers that link to the next IntSpan at each level of the node.  Most nodes are short
+   (levels 0 and 1 account for 3/4 of them), so the \c next pointers for those levels are
+   stored inline, and only taller nodes allocate a separate array.  Together with the fields
+   above, that packs a (non-debug) IntSpan into a single cache line.
+
+   Spans that are added to a RevIntSpanCol during the search are made with \ref revNew, which
+   takes their storage from the Manager's IntSpanPool rather than the heap.
 
    \ingroup clp
 */
@@ -49,6 +56,24 @@ public:
     */
     IntSpan(int min, int max, uint_t v0, uint_t v1, uint_t level = uint_t_max);
 
+    /**
+       Make a new span in the given manager's IntSpanPool.  The span is returned to the pool
+       when the manager backtracks over the current choice point.
+       \return new span
+       \param mgr associated Manager
+       \param min minimum spanned value
+       \param max maximum spanned value
+       \param v0 first mapped value
+       \param v1 second mapped value
+    */
+    static IntSpan* revNew(Manager* mgr, int min, int max, uint_t v0, uint_t v1);
+
+    /**
+       Make a copy of self in the given manager's IntSpanPool.
+       \see revNew
+    */
+    virtual IntSpan* revClone(Manager* mgr) const;
+
     virtual void copy(const utl::Object& rhs);
 
     virtual String toString() const;
@@ -242,9 +267,7 @@ public:
     //@}
 
 protected:
-#ifdef DEBUG
-    size_t _id;
-#endif
+    // note: _stateDepth, _min, _max, _v0, _v1 must be contiguous (see _saveState)
     uint_t _stateDepth;
     int _min;
     int _max;
@@ -253,6 +276,10 @@ protected:
     uint_t _level;
     IntSpan* _prev;
     IntSpan** _next;
+    IntSpan* _nextInline[CLP_INTSPAN_INLINEDEPTH];
+#ifdef DEBUG
+    size_t _id;
+#endif
 
 private:
     void init();
@@ -0,0 +1,65 @@
+#include "libclp.h"
+#include "IntSpan.h"
+#include "IntSpanPool.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+IntSpanPool::release(IntSpan* span)
+{
+    ASSERTD(_numSpans > 0);
+    span->~IntSpan();
+    auto slot = reinterpret_cast<FreeSlot*>(span);
+    slot->next = _freeList;
+    _freeList = slot;
+    --_numSpans;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+IntSpanPool::init()
+{
+    _slabPtr = nullptr;
+    _slabLim = nullptr;
+    _freeList = nullptr;
+    _numSpans = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+IntSpanPool::deInit()
+{
+    for (auto slab : _slabs)
+    {
+        delete[] slab;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+IntSpanPool::addSlab()
+{
+    // over-allocate by one slot so the first slot can be aligned on a cache line
+    auto slab = new byte_t[slabSize + slotSize];
+    _slabs.push_back(slab);
+    auto addr = reinterpret_cast<size_t>(slab);
+    addr = (addr + slotSize - 1) & ~(slotSize - 1);
+    _slabPtr = reinterpret_cast<byte_t*>(addr);
+    _slabLim = _slabPtr + slabSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLP_NS_END;
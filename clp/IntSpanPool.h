@@ -0,0 +1,114 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class IntSpan;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Slab allocator for IntSpan objects.
+
+   Each Manager owns an IntSpanPool.  Spans are carved out of large cache-line-aligned slabs
+   (one cache line per span), and released spans are kept on a free-list for re-use, so the
+   millions of spans created during a run don't each cost a trip through the heap.
+
+   \see IntSpan::revNew
+   \see Manager::revAllocate
+   \ingroup clp
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class IntSpanPool
+{
+public:
+    /** Constructor. */
+    IntSpanPool()
+    {
+        init();
+    }
+
+    /** Destructor. */
+    ~IntSpanPool()
+    {
+        deInit();
+    }
+
+    /** Get raw storage for a single span. */
+    void*
+    allocate()
+    {
+        ++_numSpans;
+        if (_freeList != nullptr)
+        {
+            auto slot = _freeList;
+            _freeList = slot->next;
+            return slot;
+        }
+        if (_slabPtr == _slabLim)
+        {
+            addSlab();
+        }
+        auto slot = _slabPtr;
+        _slabPtr += slotSize;
+        return slot;
+    }
+
+    /** Destroy the given span and return its storage to the pool. */
+    void release(IntSpan* span);
+
+    /// \name Accessors (const)
+    //@{
+    /** Get the number of live spans. */
+    size_t
+    numSpans() const
+    {
+        return _numSpans;
+    }
+
+    /** Get the total size (in bytes) of all slabs. */
+    size_t
+    size() const
+    {
+        return _slabs.size() * slabSize;
+    }
+    //@}
+
+public:
+    /** Size of a single span slot (one cache line, or two in a debug build). */
+#ifdef DEBUG
+    static const size_t slotSize = 128;
+#else
+    static const size_t slotSize = 64;
+#endif
+
+    /** Size of a slab. */
+    static const size_t slabSize = 64 * 1024;
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+private:
+    void init();
+    void deInit();
+    void addSlab();
+
+private:
+    std::vector<byte_t*> _slabs;
+    byte_t* _slabPtr;
+    byte_t* _slabLim;
+    FreeSlot* _freeList;
+    size_t _numSpans;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLP_NS_END;
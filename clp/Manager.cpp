@@ -4,6 +4,7 @@
 #include "ConstrainedVar.h"
 #include "FailEx.h"
 #include "IntSpan.h"
+#include "IntSpanPool.h"
 #include "Or.h"
 #include "Manager.h"
 
@@ -276,6 +277,7 @@ Manager::init()
     _revCtsSize = 0;
     _revActionsSize = 0;
     _revAllocationsSize = 0;
+    _revSpansSize = 0;
     _revInts = _revIntsPtr = _revIntsLim = nullptr;
     _revIntArrays = _revIntArraysPtr = _revIntArraysLim = nullptr;
     _revIntsInd = _revIntsIndPtr = _revIntsIndLim = nullptr;
@@ -285,6 +287,7 @@ Manager::init()
     _revCts = _revCtsPtr = _revCtsLim = nullptr;
     _revActions = _revActionsPtr = _revActionsLim = nullptr;
     _revAllocations = _revAllocationsPtr = _revAllocationsLim = nullptr;
+    _revSpans = _revSpansPtr = _revSpansLim = nullptr;
 
     // init skip-list delta array
     _skipListDepthArray = new SkipListDepthArray(CLP_INTSPAN_MAXDEPTH);
@@ -292,6 +295,9 @@ Manager::init()
     // create bound propagator
     _boundPropagator = new BoundPropagator(this);
 
+    // create span pool
+    _intSpanPool = new IntSpanPool();
+
     // create root choice point
     pushChoicePoint();
 }
@@ -315,6 +321,11 @@ Manager::deInit()
     deleteCont(_storedCPs);
     removeRefArray(_revCts, _revCtsPtr);
     deleteArray(_revAllocations, _revAllocationsPtr);
+    while (_revSpansPtr != _revSpans)
+    {
+        _intSpanPool->release(*--_revSpansPtr);
+    }
+    delete _intSpanPool;
 
     delete[] _revLongs;
     delete[] _revLongArrays;
@@ -329,6 +340,7 @@ Manager::deInit()
     delete[] _revCts;
     delete[] _revActions;
     delete[] _revAllocations;
+    delete[] _revSpans;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +375,7 @@ Manager::pushChoicePoint()
     cp->setRevCtsIdx(_revCtsPtr - _revCts);
     cp->setRevActionsIdx(_revActionsPtr - _revActions);
     cp->setRevAllocationsIdx(_revAllocationsPtr - _revAllocations);
+    cp->setRevSpansIdx(_revSpansPtr - _revSpans);
     _cpStack.push(cp);
     ++_cpStackSize;
     _topCP = cp;
@@ -785,6 +798,13 @@ Manager::backtrackCP(ChoicePoint* cp)
         auto object = *--_revAllocationsPtr;
         delete object;
     }
+
+    // return pooled spans that were allocated
+    auto revSpansBegin = _revSpans + cp->revSpansIdx();
+    while (_revSpansPtr != revSpansBegin)
+    {
+        _intSpanPool->release(*--_revSpansPtr);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
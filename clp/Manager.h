@@ -18,6 +18,8 @@ class ChoicePoint;
 class ConstrainedBound;
 class ConstrainedVar;
 class BoundPropagator;
+class IntSpan;
+class IntSpanPool;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -155,6 +157,13 @@ public:
         return _boundPropagator;
     }
 
+    /** Get the span pool. */
+    IntSpanPool*
+    intSpanPool() const
+    {
+        return _intSpanPool;
+    }
+
     /** Get constraints begin iterator. */
     ct_set_t::const_iterator
     ctsBegin() const
@@ -330,6 +339,19 @@ public:
         *_revAllocationsPtr++ = object;
     }
 
+    /** Return the given span to the span pool when backtracking. */
+    void
+    revAllocateSpan(IntSpan* span)
+    {
+        if (_revSpansPtr == _revSpansLim)
+        {
+            utl::arrayGrow(_revSpans, _revSpansPtr, _revSpansLim,
+                           utl::max(utl::KB(4), (_revSpansSize + 1)));
+            _revSpansSize = _revSpansLim - _revSpans;
+        }
+        *_revSpansPtr++ = span;
+    }
+
     /** Execute the given function when backtracking. */
     void
     revAction(lut::Functor* action)
@@ -378,6 +400,7 @@ private:
     cv_set_t _vars;
     lut::SkipListDepthArray* _skipListDepthArray;
     BoundPropagator* _boundPropagator;
+    IntSpanPool* _intSpanPool;
 
     // Backtracking ////////////////////////////////////////////////////////////////////////////////
 
@@ -464,6 +487,12 @@ private:
     utl::Object** _revAllocationsPtr;
     utl::Object** _revAllocationsLim;
     size_t _revAllocationsSize;
+
+    // pooled spans
+    IntSpan** _revSpans;
+    IntSpan** _revSpansPtr;
+    IntSpan** _revSpansLim;
+    size_t _revSpansSize;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
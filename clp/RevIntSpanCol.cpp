@@ -39,8 +39,7 @@ RevIntSpanCol::copy(const RevIntSpanCol& isc)
     for (auto span = isc.head()->next(); span != isc.tail(); span = span->next())
     {
         // make a new span
-        auto mySpan = span->clone();
-        _mgr->revAllocate(mySpan);
+        auto mySpan = span->revClone(_mgr);
 
         // link new span to predecessors
         uint_t level = insertAfter(mySpan, prev);
@@ -164,6 +163,14 @@ RevIntSpanCol::newIntSpan(int min, int max, uint_t v0, uint_t v1, uint_t level)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+IntSpan*
+RevIntSpanCol::revNewIntSpan(int min, int max, uint_t v0, uint_t v1)
+{
+    return IntSpan::revNew(_mgr, min, max, v0, v1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 RevIntSpanCol::set(IntSpan* span)
 {
@@ -182,9 +189,8 @@ void
 RevIntSpanCol::set(int min, int max, uint_t v0, uint_t v1)
 {
     saveState();
-    IntSpan* span = newIntSpan(min, max, v0, v1);
+    IntSpan* span = revNewIntSpan(min, max, v0, v1);
     span->setStateDepth(_stateDepth);
-    _mgr->revAllocate(span);
     set(span);
 }
 
@@ -123,6 +123,8 @@ protected:
 
     virtual IntSpan* newIntSpan(int min, int max, uint_t v0, uint_t v1, uint_t level = uint_t_max);
 
+    virtual IntSpan* revNewIntSpan(int min, int max, uint_t v0, uint_t v1);
+
     virtual void set(IntSpan* span);
     void set(int min, int max, uint_t v0, uint_t v1);
 
@@ -45,12 +45,59 @@ CapExp::compare(const Object& rhs) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+IntExp*
+CapExp::get()
+{
+    if (!_live)
+    {
+        materialize();
+    }
+    return _capExp;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+CapExp::acquire()
+{
+    auto mgr = _capExpMgr->schedule()->manager();
+    mgr->revSet(_numObservers);
+    ++_numObservers;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
-CapExp::initExp(const Schedule* schedule)
+CapExp::release()
+{
+    ASSERTD(_numObservers > 0);
+    auto mgr = _capExpMgr->schedule()->manager();
+    mgr->revSet(_numObservers);
+    if ((--_numObservers == 0) && _live)
+    {
+        dematerialize();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+CapExp::deInit()
+{
+    delete _capExp;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+CapExp::initialize()
 {
     ASSERTD(_capExp == nullptr);
-    auto mgr = schedule->manager();
-    _capExp = new IntVar(mgr);
+    auto schedule = _capExpMgr->schedule();
+    _capExp = new IntVar(schedule->manager());
+
+    // make each resource's capacity expression (it's maintained from now on, so materialization
+    // doesn't have to make it again after backtracking)
     auto resourcesArray = schedule->resourcesArray();
     for (uint_t idx = 0; idx != _resCaps.size(); idx += 2)
     {
@@ -58,77 +105,119 @@ CapExp::initExp(const Schedule* schedule)
         uint_t cap = _resCaps[idx + 1];
         auto res = resourcesArray[resSid];
         auto cres = utl::cast<CompositeResource>(res);
-        auto& timetable = cres->timetable();
-        auto resCapExp = timetable.addCapExp(cap);
-        _capExp->intersect(resCapExp);
+        cres->timetable().addCapExp(cap);
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-IntExp*
-CapExp::get(const Schedule* schedule) const
+void
+CapExp::materialize()
 {
-    ASSERTD(_capExp != nullptr);
+    ASSERTD(!_live);
+    auto schedule = _capExpMgr->schedule();
+    auto mgr = schedule->manager();
 
-    // first use: set up propagation
-    if (_useCount == 0)
+    // intersect with each resource's capacity expression, and have it propagate to us
+    // note: while we weren't live, our domain was a superset of the correct domain, so this
+    //       brings it up to date (no matter which spans were changed in the meantime)
+    auto resourcesArray = schedule->resourcesArray();
+    for (uint_t idx = 0; idx != _resCaps.size(); idx += 2)
     {
-        auto mgr = schedule->manager();
-        mgr->revSet(_useCount);
-        auto resourcesArray = schedule->resourcesArray();
-        for (uint_t idx = 0; idx != _resCaps.size(); idx += 2)
-        {
-            uint_t resSid = _resCaps[idx];
-            uint_t cap = _resCaps[idx + 1];
-            auto res = resourcesArray[resSid];
-            auto cres = utl::cast<CompositeResource>(res);
-            auto& timetable = cres->timetable();
-            auto resCapExp = timetable.addCapExp(cap);
-            resCapExp->addIntersectExp(_capExp);
-        }
+        uint_t resSid = _resCaps[idx];
+        uint_t cap = _resCaps[idx + 1];
+        auto res = resourcesArray[resSid];
+        auto cres = utl::cast<CompositeResource>(res);
+        auto resCapExp = cres->timetable().findCapExp(cap);
+        ASSERTD(resCapExp != nullptr);
+        _capExp->intersect(resCapExp);
+        resCapExp->addIntersectExp(_capExp);
+    }
+
+    // we're live (until dematerialize() or backtracking)
+    mgr->revToggle(_live);
+    mgr->revSet(_capExpMgr->_numLive);
+    ++_capExpMgr->_numLive;
+
+    // count it as touched
+    if (!_touched)
+    {
+        _touched = true;
+        ++_capExpMgr->_numTouched;
     }
-    ++_useCount;
-    return _capExp;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void
-CapExp::deInit()
+CapExp::dematerialize()
 {
-    delete _capExp;
+    ASSERTD(_live);
+    auto schedule = _capExpMgr->schedule();
+    auto mgr = schedule->manager();
+
+    // stop propagation from each resource's capacity expression
+    auto resourcesArray = schedule->resourcesArray();
+    for (uint_t idx = 0; idx != _resCaps.size(); idx += 2)
+    {
+        uint_t resSid = _resCaps[idx];
+        uint_t cap = _resCaps[idx + 1];
+        auto res = resourcesArray[resSid];
+        auto cres = utl::cast<CompositeResource>(res);
+        auto resCapExp = cres->timetable().findCapExp(cap);
+        ASSERTD(resCapExp != nullptr);
+        resCapExp->removeIntersectExp(_capExp);
+    }
+
+    mgr->revToggle(_live);
+    mgr->revSet(_capExpMgr->_numLive);
+    --_capExpMgr->_numLive;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// CapExpMgr //////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void
+CapExp*
 CapExpMgr::add(const uint_vector_t& resCaps)
 {
-    auto capExp = new CapExp(resCaps);
-
     // already have it?
-    if (_capExps.has(*capExp))
+    auto capExp = find(resCaps);
+    if (capExp != nullptr)
     {
-        delete capExp;
-        return;
+        return capExp;
     }
 
     // add it
-    capExp->initExp(_schedule);
+    capExp = new CapExp(this, resCaps);
+    capExp->initialize();
     _capExps += capExp;
+    return capExp;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-IntExp*
+CapExp*
 CapExpMgr::find(const uint_vector_t& resCaps) const
 {
-    auto capExp = utl::cast<CapExp>(_capExps.find(CapExp(resCaps)));
-    auto intExp = capExp->get(_schedule);
-    return intExp;
+    return (CapExp*)_capExps.find(CapExp(nullptr, resCaps));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+CapExpMgr::clearStats()
+{
+    _numTouched = 0;
+    for (auto capExp_ : _capExps)
+    {
+        auto capExp = utl::cast<CapExp>(capExp_);
+        capExp->_touched = capExp->_live;
+        if (capExp->_touched)
+        {
+            ++_numTouched;
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
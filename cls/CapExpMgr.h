@@ -2,7 +2,7 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#include <clp/IntExp.h>
+#include <clp/IntVar.h>
 #include <cls/Schedule.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -11,12 +11,24 @@ CLS_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+class CapExpMgr;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    Capacity expression.
 
    A capacity expression is an IntVar that tracks the time when a set of CompositeResource%s all
    have the required capacity.
 
+   A CapExp is materialized lazily.  Its variable (and the capacity expressions of the individual
+   CompositeTimetable%s that it depends on) are made once, when the model is built, but its domain
+   is only computed (by intersecting it with the timetables' expressions) when it is first
+   requested (\ref get), and it is only kept up to date while it's live.  Materialization is
+   reversible, so a CapExp that's materialized during a scheduling run is discarded when the
+   Manager backtracks past the choice point where it was materialized.  A CapExp also stops being live when the last activity observing it
+   (\ref acquire) has allocated its capacity (\ref release).
+
    \see IntActivity
    \see CompositeResource
    \see CompositeTimetable
@@ -32,22 +44,46 @@ class CapExp : public utl::Object
 public:
     /**
        Constructor.
+       \param capExpMgr owning CapExpMgr
        \param resCaps array of `[resourceSerialId,capacity]` tuples
     */
-    CapExp(const uint_vector_t& resCaps)
+    CapExp(CapExpMgr* capExpMgr, const uint_vector_t& resCaps)
     {
+        _capExpMgr = capExpMgr;
         _resCaps = resCaps;
-        _useCount = 0;
         _capExp = nullptr;
+        _numObservers = 0;
+        _live = false;
+        _touched = false;
     }
 
     virtual int compare(const utl::Object& rhs) const;
 
-    /** Initialize the capacity expression. */
-    void initExp(const Schedule* schedule);
+    /** Get the capacity expression (materializing it if necessary). */
+    clp::IntExp* get();
+
+    /** Add an observer. */
+    void acquire();
+
+    /** Remove an observer (the expression is no longer maintained after the last one). */
+    void release();
+
+    /// \name Accessors (const)
+    //@{
+    /** Is the expression currently materialized and maintained? */
+    bool
+    live() const
+    {
+        return _live;
+    }
 
-    /** Get the capacity expression. */
-    clp::IntExp* get(const Schedule* schedule) const;
+    /** Has the expression been materialized since CapExpMgr::clearStats? */
+    bool
+    touched() const
+    {
+        return _touched;
+    }
+    //@}
 
 private:
     void
@@ -57,10 +93,19 @@ private:
     }
     void deInit();
 
+    void initialize();
+    void materialize();
+    void dematerialize();
+
 private:
+    friend class CapExpMgr;
+
+    CapExpMgr* _capExpMgr;
     uint_vector_t _resCaps;
-    mutable uint_t _useCount;
-    mutable clp::IntExp* _capExp;
+    clp::IntVar* _capExp;
+    uint_t _numObservers;
+    bool _live;
+    bool _touched;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +119,9 @@ private:
    IntActivity has a single CompositeResourceRequirement, it uses a capacity expression
    for that CompositeResource (see CompositeTimetable::addCapExp).
 
+   CapExpMgr also counts how many of its expressions are live, and how many have been touched
+   (materialized) since the last call to \ref clearStats.
+
    \see CapExp
    \see CompositeResource
    \see CompositeResourceRequirement
@@ -97,23 +145,63 @@ public:
     CapExpMgr(Schedule* schedule)
     {
         _schedule = schedule;
+        _numLive = 0;
+        _numTouched = 0;
     }
 
     /**
-       Add a capacity expression.
+       Add a capacity expression (or find the existing one).
        \param resCaps array of `[resourceSerialId,capacity]` tuples
     */
-    void add(const uint_vector_t& resCaps);
+    CapExp* add(const uint_vector_t& resCaps);
 
     /**
        Find capacity expression.
        \param resCaps array of `[resourceSerialId,capacity]` tuples
     */
-    clp::IntExp* find(const uint_vector_t& resCaps) const;
+    CapExp* find(const uint_vector_t& resCaps) const;
+
+    /** Reset the count of touched expressions (e.g. at the start of a scheduling run). */
+    void clearStats();
+
+    /// \name Accessors (const)
+    //@{
+    /** Get the schedule. */
+    const Schedule*
+    schedule() const
+    {
+        return _schedule;
+    }
+
+    /** Get the number of capacity expressions. */
+    uint_t
+    numCapExps() const
+    {
+        return _capExps.size();
+    }
+
+    /** Get the number of live capacity expressions. */
+    uint_t
+    numLive() const
+    {
+        return _numLive;
+    }
+
+    /** Get the number of capacity expressions touched since the last clearStats(). */
+    uint_t
+    numTouched() const
+    {
+        return _numTouched;
+    }
+    //@}
 
 private:
+    friend class CapExp;
+
     const Schedule* _schedule;
     utl::RBtree _capExps;
+    uint_t _numLive;
+    uint_t _numTouched;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,4 +1,5 @@
 #include "libcls.h"
+#include <clp/IntSpanPool.h>
 #include "CompositeSpan.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +18,11 @@ CLS_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static_assert(sizeof(CompositeSpan) <= IntSpanPool::slotSize,
+              "CompositeSpan doesn't fit in a pool slot");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 CompositeSpan::CompositeSpan(int min, int max, IntExpDomainAR* resIds, uint_t level)
     : IntSpan(min, max, 0, 0, level)
 {
@@ -25,6 +31,30 @@ CompositeSpan::CompositeSpan(int min, int max, IntExpDomainAR* resIds, uint_t le
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#undef new
+
+CompositeSpan*
+CompositeSpan::revNew(Manager* mgr, int min, int max, IntExpDomainAR* resIds)
+{
+    auto span = new (mgr->intSpanPool()->allocate()) CompositeSpan(min, max, resIds);
+    mgr->revAllocateSpan(span);
+    return span;
+}
+
+#include <libutl/gblnew_macros.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+IntSpan*
+CompositeSpan::revClone(Manager* mgr) const
+{
+    auto resIds = this->resIds()->clone();
+    mgr->revAllocate(resIds);
+    return revNew(mgr, _min, _max, resIds);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 CompositeSpan::copy(const Object& rhs)
 {
@@ -39,6 +39,14 @@ public:
                   clp::IntExpDomainAR* resIds = nullptr,
                   uint_t level = uint_t_max);
 
+    /**
+       Make a new span in the given manager's IntSpanPool.
+       \see clp::IntSpan::revNew
+    */
+    static CompositeSpan* revNew(clp::Manager* mgr, int min, int max, clp::IntExpDomainAR* resIds);
+
+    virtual clp::IntSpan* revClone(clp::Manager* mgr) const;
+
     virtual void copy(const utl::Object& rhs);
 
     virtual String toString() const;
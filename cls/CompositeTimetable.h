@@ -103,6 +103,13 @@ public:
     {
         _domain.remCapExp(cap);
     }
+
+    /** Find the capacity-expression for the given capacity (if any). */
+    clp::IntExp*
+    findCapExp(uint_t cap) const
+    {
+        return _domain.findCapExp(cap);
+    }
     //@}
 
     /// \name Query
@@ -423,7 +423,7 @@ CompositeTimetableDomain::allocate(int min,
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 CompositeSpan*
-CompositeTimetableDomain::newCS(int min, int max, IntExpDomainAR* resIds, uint_t level)
+CompositeTimetableDomain::newCS(int min, int max, IntExpDomainAR* resIds)
 {
     ASSERTD(_values != nullptr);
 
@@ -433,10 +433,7 @@ CompositeTimetableDomain::newCS(int min, int max, IntExpDomainAR* resIds, uint_t
         _mgr->revAllocate(resIds);
     }
 
-    CompositeSpan* span = new CompositeSpan(min, max, resIds, level);
-
-    _mgr->revAllocate(span);
-    return span;
+    return CompositeSpan::revNew(_mgr, min, max, resIds);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -460,6 +457,17 @@ CompositeTimetableDomain::newIntSpan(int min,
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+IntSpan*
+CompositeTimetableDomain::revNewIntSpan(int min,
+                                        int max,
+                                        uint_t, // v0 (unused)
+                                        uint_t) // v1 (unused)
+{
+    return newCS(min, max);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 CompositeTimetableDomain::init()
 {
@@ -53,6 +53,13 @@ public:
 
     /** Remove capacity-expression. */
     void remCapExp(uint_t cap);
+
+    /** Find the capacity-expression for the given capacity (if any). */
+    clp::IntExp*
+    findCapExp(uint_t cap) const
+    {
+        return (cap < _capExpsSize) ? _capExps[cap] : nullptr;
+    }
     //@}
 
     /// \name Capacity Provision and Allocation
@@ -126,12 +133,13 @@ protected:
     };
 
 protected:
-    CompositeSpan*
-    newCS(int min, int max, clp::IntExpDomainAR* resIds = nullptr, uint_t level = uint_t_max);
+    CompositeSpan* newCS(int min, int max, clp::IntExpDomainAR* resIds = nullptr);
 
     virtual clp::IntSpan*
     newIntSpan(int min, int max, uint_t v0, uint_t v1, uint_t level = uint_t_max);
 
+    virtual clp::IntSpan* revNewIntSpan(int min, int max, uint_t v0, uint_t v1);
+
 private:
     void init();
     void deInit();
@@ -2,6 +2,7 @@
 #include "TimetableBound.h"
 #include "CompositeResource.h"
 #include "DiscreteResource.h"
+#include "ResourceSetupTimes.h"
 #include "Schedule.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -132,6 +133,31 @@ DiscreteResource::allocate(int min, int max, uint_t cap, PtActivity* act, bool u
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+DiscreteResource::allocate(const tt_window_vector_t& windows,
+                           PtActivity* act,
+                           bool updateComposite)
+{
+    _timetable.add(windows);
+
+    // update composite resource timetables?
+    if (updateComposite)
+    {
+        auto resourcesArray = schedule()->resourcesArray();
+        for (auto resSid : _crIds)
+        {
+            auto cres = utl::cast<CompositeResource>(resourcesArray[resSid]);
+            for (auto& window : windows)
+            {
+                cres->allocate(window.min, window.max, 1, act, nullptr, nullptr, this->serialId(),
+                               false);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 DiscreteResource::deallocate(int min, int max, uint_t cap, bool updateComposite)
 {
@@ -153,6 +179,35 @@ DiscreteResource::deallocate(int min, int max, uint_t cap, bool updateComposite)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+DiscreteResource::deallocate(const tt_window_vector_t& windows, bool updateComposite)
+{
+    _tmpWindows.clear();
+    for (auto& window : windows)
+    {
+        _tmpWindows.push_back(TimetableWindow{window.min, window.max, -window.reqCap, 0});
+    }
+    _timetable.add(_tmpWindows);
+
+    if (!updateComposite)
+    {
+        return;
+    }
+
+    // update composite resource timetables
+    auto resourcesArray = schedule()->resourcesArray();
+    for (auto resSid : _crIds)
+    {
+        auto cres = utl::cast<CompositeResource>(resourcesArray[resSid]);
+        for (auto& window : windows)
+        {
+            cres->add(window.min, window.max, this->serialId());
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 DiscreteResource::selectCapacity(uint_t cap, uint_t maxCap)
 {
@@ -204,6 +259,61 @@ DiscreteResource::selectCapacity(uint_t cap, uint_t maxCap)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+DiscreteResource::setSetupTimes(ResourceSetupTimes* setupTimes)
+{
+    ASSERTD(_unary || (setupTimes == nullptr));
+    delete _setupTimes;
+    _setupTimes = setupTimes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int
+DiscreteResource::setupBound(const Activity* act, int es, int ef) const
+{
+    ASSERTD(_setupTimes != nullptr);
+
+    // first activity that starts after es
+    uint_t succIdx = _unaryTimetable.upperBound(es);
+
+    // act must start after its predecessor's end + setup
+    for (uint_t idx = succIdx; idx-- != 0;)
+    {
+        auto pred = _unaryTimetable.activity(idx);
+        if (pred == act)
+        {
+            continue;
+        }
+        uint_t setup = _setupTimes->setupTime(pred, act);
+        if ((setup > 0) && (es <= (pred->ef() + (int)setup)))
+        {
+            return pred->ef() + (int)setup + 1;
+        }
+        break;
+    }
+
+    // act's end + setup must be before its successor's start (else act must follow it)
+    for (uint_t idx = succIdx; idx != _unaryTimetable.size(); ++idx)
+    {
+        auto succ = _unaryTimetable.activity(idx);
+        if (succ == act)
+        {
+            continue;
+        }
+        uint_t setup = _setupTimes->setupTime(act, succ);
+        if ((setup > 0) && (succ->es() <= (ef + (int)setup)))
+        {
+            return utl::max(es + 1, succ->ef() + 1);
+        }
+        break;
+    }
+
+    return es;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 DiscreteResource::doubleProvidedCap()
 {
@@ -245,6 +355,8 @@ DiscreteResource::init()
     _timetableBounds.setOwner(false);
     _timetableBounds.setOrdering(new TimetableBoundOrderingDecCap());
     _calendar = nullptr;
+    _energyCt = nullptr;
+    _setupTimes = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +364,7 @@ DiscreteResource::init()
 void
 DiscreteResource::deInit()
 {
+    delete _setupTimes;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
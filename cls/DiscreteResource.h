@@ -6,6 +6,7 @@
 #include <cls/Activity.h>
 #include <cls/Resource.h>
 #include <cls/DiscreteTimetable.h>
+#include <cls/UnaryTimetable.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -13,7 +14,9 @@ CLS_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+class DiscreteResourceEnergyCt;
 class PtActivity;
+class ResourceSetupTimes;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -24,6 +27,7 @@ class PtActivity;
 
    - a ResourceCalendar that specifies whether it's working or on break in each time slot
    - a DiscreteTimetable that tracks the required and provided capacity in each time slot
+   - a UnaryTimetable that tracks the sequence of activities (unary resource only)
 
    \see BrkActivity
    \see DiscreteTimetable
@@ -47,6 +51,7 @@ public:
     {
         init();
         _timetable.setManager(manager());
+        _unaryTimetable.setManager(manager());
     }
 
     /** Initialize. */
@@ -82,11 +87,11 @@ public:
         return _timetable;
     }
 
-    /** Get activities sorted by start-time. */
-    const act_set_es_t&
-    actsByStartTime() const
+    /** Get the unary timetable (activities sorted by start-time). */
+    const UnaryTimetable&
+    unaryTimetable() const
     {
-        return _actsByStartTime;
+        return _unaryTimetable;
     }
 
     /** Get min required capacity */
@@ -109,6 +114,20 @@ public:
     {
         return _crIds;
     }
+
+    /** Get the energetic-reasoning constraint (if any). */
+    DiscreteResourceEnergyCt*
+    energyCt() const
+    {
+        return _energyCt;
+    }
+
+    /** Get the sequence-dependent setup times (if any). */
+    const ResourceSetupTimes*
+    setupTimes() const
+    {
+        return _setupTimes;
+    }
     //@}
 
     /// \name Accessors (non-const)
@@ -120,13 +139,16 @@ public:
         return _timetable;
     }
 
-    /** Get activities sorted by start-time. */
-    act_set_es_t&
-    actsByStartTime()
+    /** Get the unary timetable (activities sorted by start-time). */
+    UnaryTimetable&
+    unaryTimetable()
     {
-        return _actsByStartTime;
+        return _unaryTimetable;
     }
 
+    /** Set the sequence-dependent setup times (unary resource only, takes ownership). */
+    void setSetupTimes(ResourceSetupTimes* setupTimes);
+
     /** Set minimum required capacity. */
     void
     setMinReqCap(uint_t minReqCap)
@@ -147,6 +169,13 @@ public:
     {
         return _crIds;
     }
+
+    /** Set the energetic-reasoning constraint (see DiscreteResourceEnergyCt::post). */
+    void
+    setEnergyCt(DiscreteResourceEnergyCt* energyCt)
+    {
+        _energyCt = energyCt;
+    }
     //@}
 
     /// Timetable
@@ -166,6 +195,17 @@ public:
     */
     void allocate(int min, int max, uint_t cap, PtActivity* act, bool updateComposite = true);
 
+    /**
+       Allocate capacity over a series of sorted, non-overlapping windows.
+       \param windows allocation windows (each window's \b reqCap is the allocated capacity)
+       \param act responsible Activity
+       \param updateComposite also allocate capacity in CompositeResource%s? (default: true)
+       \see DiscreteTimetable::add(const tt_window_vector_t&)
+    */
+    void allocate(const tt_window_vector_t& windows,
+                  PtActivity* act,
+                  bool updateComposite = true);
+
     /**
        Deallocate capacity.
        \param min start of deallocation span
@@ -177,9 +217,27 @@ public:
     */
     void deallocate(int min, int max, uint_t cap, bool updateComposite = true);
 
+    /**
+       Deallocate capacity over a series of sorted, non-overlapping windows.
+       \param windows deallocation windows (each window's \b reqCap is the deallocated capacity)
+       \param updateComposite also allocate capacity in CompositeResource%s? (default: true)
+       \see DiscreteTimetable::add(const tt_window_vector_t&)
+    */
+    void deallocate(const tt_window_vector_t& windows, bool updateComposite = true);
+
     /** Set resource's capacity to the given cap. */
     void selectCapacity(uint_t cap, uint_t maxCap);
 
+    /**
+       Find the earliest start time that leaves room for the setups with the activities that are
+       already scheduled on the resource (see ResourceSetupTimes).
+       \return es if [es,ef] is OK, otherwise a later start time to try
+       \param act activity being scheduled
+       \param es start time for act
+       \param ef end time for act
+    */
+    int setupBound(const Activity* act, int es, int ef) const;
+
     /** Double provided capacity for every span. */
     void doubleProvidedCap();
 
@@ -277,12 +335,15 @@ public:
 protected:
     bool _unary;
     DiscreteTimetable _timetable;
-    act_set_es_t _actsByStartTime;
+    UnaryTimetable _unaryTimetable;
     uint_t _minReqCap;
     uint_t _maxReqCap;
     utl::RBtree _timetableBounds;
     ResourceCalendar* _calendar;
     uint_vector_t _crIds;
+    DiscreteResourceEnergyCt* _energyCt;
+    ResourceSetupTimes* _setupTimes;
+    tt_window_vector_t _tmpWindows; // scratch space for deallocate()
 
 private:
     void init();
@@ -0,0 +1,185 @@
+#include "libcls.h"
+#include <libutl/Uint.h>
+#include <clp/FailEx.h>
+#include "DiscreteResource.h"
+#include "DiscreteResourceEnergyCt.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+CLP_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(cls::DiscreteResourceEnergyCt);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DiscreteResourceEnergyCt::DiscreteResourceEnergyCt(DiscreteResource* res)
+    : Constraint(res->manager())
+{
+    init();
+    _res = res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+DiscreteResourceEnergyCt::add(BrkActivity* act, const ResourceCapPts* resCapPts)
+{
+    ASSERTD(resCapPts->resource() == _res);
+    _acts.push_back(ActCapPts{act, resCapPts});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+DiscreteResourceEnergyCt::execute()
+{
+    // collect unallocated activities (and their window start times)
+    _tasks.clear();
+    _starts.clear();
+    for (auto& acp : _acts)
+    {
+        auto act = acp.act;
+        if (act->allocated())
+        {
+            continue;
+        }
+        uint64_t energy = minEnergy(act, acp.resCapPts);
+        if (energy == 0)
+        {
+            continue;
+        }
+        _tasks.push_back(Task{act->es(), act->lf(), energy});
+        _starts.push_back(act->es());
+    }
+
+    // fewer than two activities -> timetable propagation is sufficient
+    if (_tasks.size() < 2)
+    {
+        return;
+    }
+
+    // order tasks by LF, and find distinct window start times
+    std::sort(_tasks.begin(), _tasks.end(),
+              [](const Task& lhs, const Task& rhs) { return lhs.lf < rhs.lf; });
+    std::sort(_starts.begin(), _starts.end());
+    _starts.erase(std::unique(_starts.begin(), _starts.end()), _starts.end());
+
+    // check each window [t1,t2]
+    auto& timetable = _res->timetable();
+    auto tail = timetable.tail();
+    for (auto t1 : _starts)
+    {
+        uint64_t required = 0;
+        uint64_t available = 0;
+
+        // available energy has been accumulated over [t1,availEnd-1]
+        auto span = timetable.find(t1);
+        int availEnd = t1;
+
+        // visit tasks in LF order (so t2 = task.lf is non-decreasing)
+        for (auto& task : _tasks)
+        {
+            // task may start before t1 -> it's not contained in the window
+            if ((task.es < t1) || (task.lf < t1))
+            {
+                continue;
+            }
+            required += task.energy;
+            int t2 = task.lf;
+
+            // accumulate available energy over [availEnd,t2]
+            while ((span != tail) && (availEnd <= t2))
+            {
+                int spanEnd = utl::min(span->max(), t2);
+                if (span->v1() > span->v0())
+                {
+                    uint64_t cap = span->v1() - span->v0();
+                    available += cap * (uint64_t)(spanEnd - availEnd + 1);
+                }
+                availEnd = spanEnd + 1;
+                if (availEnd > span->max())
+                {
+                    span = span->next();
+                }
+            }
+
+            // required energy exceeds available energy -> fail
+            if (required > available)
+            {
+                throw FailEx("res-" + Uint(_res->id()).toString() + ": " + "energy overload");
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+DiscreteResourceEnergyCt::post()
+{
+    ASSERTD(_res->energyCt() == nullptr);
+    _res->setEnergyCt(this);
+    setPosted(true);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+DiscreteResourceEnergyCt::unpost()
+{
+    if (!posted())
+    {
+        return;
+    }
+    _res->setEnergyCt(nullptr);
+    setPosted(false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+DiscreteResourceEnergyCt::init()
+{
+    _res = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t
+DiscreteResourceEnergyCt::minEnergy(const BrkActivity* act, const ResourceCapPts* resCapPts)
+{
+    // cap/pt already selected?
+    auto selectedCapPt = resCapPts->selectedCapPt();
+    if (selectedCapPt != nullptr)
+    {
+        return (uint64_t)selectedCapPt->capacity() * (uint64_t)selectedCapPt->processingTime();
+    }
+
+    // find the minimum energy over all possible cap/pt pairs
+    auto possiblePts = &act->possiblePts();
+    uint64_t energy = UINT64_MAX;
+    uint_t numCapPts = resCapPts->capPtsArray().size();
+    for (uint_t i = 0; i != numCapPts; ++i)
+    {
+        uint_t cap, pt;
+        resCapPts->getCapPt(i, cap, pt);
+        if ((pt == uint_t_max) || ((possiblePts != nullptr) && !possiblePts->has(pt)))
+        {
+            continue;
+        }
+        energy = utl::min(energy, (uint64_t)cap * (uint64_t)pt);
+    }
+    return (energy == UINT64_MAX) ? 0 : energy;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_END;
@@ -0,0 +1,119 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <clp/Constraint.h>
+#include <cls/BrkActivity.h>
+#include <cls/ResourceCapPts.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class DiscreteResource;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Energetic-reasoning constraint for a DiscreteResource.
+
+   Timetable propagation (see ESboundTimetable) only considers capacity that has already been
+   allocated, so a resource can be hopelessly overloaded by the activities still waiting to be
+   scheduled without any bound being affected until the schedule is nearly complete.
+
+   DiscreteResourceEnergyCt tracks the activities that \b must execute on its resource.  When
+   executed, it considers every window `[t1,t2]` where `t1` is the ES of an unallocated
+   activity, and `t2` is the LF of an unallocated activity.  The minimal energy (capacity *
+   processing-time) required by the unallocated activities that must execute entirely within
+   the window is compared to the energy that remains available in the resource's timetable over
+   the window.  If the required energy is greater, FailEx is thrown.
+
+   The check takes O(n * (n + s)) time for n unallocated activities and s timetable spans, so it
+   is run explicitly (see cse::SchedulingContext::schedule) rather than on every timetable event.
+
+   \see DiscreteResource
+   \see DiscreteTimetable
+   \ingroup cls
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class DiscreteResourceEnergyCt : public clp::Constraint
+{
+    UTL_CLASS_DECL(DiscreteResourceEnergyCt, clp::Constraint);
+    UTL_CLASS_NO_COPY;
+
+public:
+    /**
+       Constructor.
+       \param res constrained resource
+    */
+    DiscreteResourceEnergyCt(DiscreteResource* res);
+
+    /**
+       Add an activity that must execute on the resource.
+       \param act activity
+       \param resCapPts act's possible `[capacity,processing-time]` pairs for the resource
+    */
+    void add(BrkActivity* act, const ResourceCapPts* resCapPts);
+
+    virtual void execute();
+
+    virtual void post();
+
+    virtual void unpost();
+
+    /// \name Accessors (const)
+    //@{
+    /** Get the resource. */
+    const DiscreteResource*
+    resource() const
+    {
+        return _res;
+    }
+
+    /** Get the number of activities. */
+    uint_t
+    numActivities() const
+    {
+        return _acts.size();
+    }
+    //@}
+
+private:
+    struct ActCapPts
+    {
+        BrkActivity* act;
+        const ResourceCapPts* resCapPts;
+    };
+
+    struct Task
+    {
+        int es;
+        int lf;
+        uint64_t energy;
+    };
+
+private:
+    void init();
+    void
+    deInit()
+    {
+    }
+
+    static uint64_t minEnergy(const BrkActivity* act, const ResourceCapPts* resCapPts);
+
+private:
+    DiscreteResource* _res;
+    std::vector<ActCapPts> _acts;
+
+    // scratch space for execute()
+    std::vector<Task> _tasks;
+    std::vector<int> _starts;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_END;
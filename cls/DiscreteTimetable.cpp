@@ -125,6 +125,17 @@ DiscreteTimetable::add(int min, int max, int reqCap, int prvCap)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+uint_t
+DiscreteTimetable::add(const tt_window_vector_t& windows)
+{
+    uint_t minCap = _domain.add(windows);
+    if (_domain.anyEvent())
+        raiseEvents();
+    return minCap;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 DiscreteTimetable::init()
 {
@@ -143,6 +143,15 @@ public:
        \return minimum available capacity in the time span
     */
     uint_t add(int min, int max, int reqCap, int prvCap);
+
+    /**
+       Add required and/or provided capacity over a series of sorted, non-overlapping windows.
+       Events are raised once, after all windows have been updated.
+       \param windows windows to update
+       \return minimum available capacity in the updated windows
+       \see DiscreteTimetableDomain::add(const tt_window_vector_t&)
+    */
+    uint_t add(const tt_window_vector_t& windows);
     //@}
 
     /// \name Events
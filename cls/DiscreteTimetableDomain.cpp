@@ -55,6 +55,24 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
 
     // --- initialize ---------------------------------------------------------
 
+#ifdef DEBUG_UNIT
+    validate();
+#endif
+
+    saveState();
+
+    IntSpan* prev[CLP_INTSPAN_MAXDEPTH];
+    findPrev(min, prev);
+    return add(min, max, v0, v1, prev);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+DiscreteTimetableDomain::add(const tt_window_vector_t& windows)
+{
+    ASSERTD(_mgr != nullptr);
+
 #ifdef DEBUG_UNIT
     validate();
 #endif
@@ -62,10 +80,62 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
     uint_t minCap = int_t_max;
     saveState();
 
-    // find minSpan, maxSpan
     IntSpan* prev[CLP_INTSPAN_MAXDEPTH];
+    bool found = false;
+#ifdef DEBUG
+    int lastMax = int_t_min;
+#endif
+    for (auto& window : windows)
+    {
+        if ((window.reqCap == 0) && (window.prvCap == 0))
+        {
+            continue;
+        }
+
+        int min = utl::max(window.min, int_t_min + 2);
+        int max = utl::min(window.max, int_t_max - 2);
+        if (min > max)
+        {
+            continue;
+        }
+#ifdef DEBUG
+        ASSERT(min > lastMax);
+        lastMax = max;
+#endif
+
+        // first window: search from the head, else continue from the previous window
+        if (found)
+        {
+            findPrevForward(min, prev);
+        }
+        else
+        {
+            findPrev(min, prev);
+            found = true;
+        }
+
+        minCap = utl::min(minCap, add(min, max, window.reqCap, window.prvCap, prev));
+
+        // overallocation -> stop here (the caller will fail)
+        if (emptyEvent())
+        {
+            break;
+        }
+    }
+
+    return minCap;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+DiscreteTimetableDomain::add(int min, int max, int v0, int v1, IntSpan** prev)
+{
+    uint_t minCap = int_t_max;
+
+    // find minSpan, maxSpan
     IntSpan* next[CLP_INTSPAN_MAXDEPTH];
-    IntSpan* minSpan = findPrev(min, prev);
+    IntSpan* minSpan = prev[0]->next();
     IntSpan* maxSpan;
     if (minSpan->max() >= max)
     {
@@ -185,8 +255,7 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
             }
             else
             {
-                IntSpan* newSpan = new IntSpan(min, max, newv0, newv1);
-                _mgr->revAllocate(newSpan);
+                IntSpan* newSpan = IntSpan::revNew(_mgr, min, max, newv0, newv1);
                 insertAfter(newSpan, prev);
             }
         }
@@ -202,8 +271,7 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
             {
                 findPrevForward(span->max() + 1, prev);
                 span->setMax(min - 1);
-                auto newSpan = new IntSpan(min, max, newv0, newv1);
-                _mgr->revAllocate(newSpan);
+                auto newSpan = IntSpan::revNew(_mgr, min, max, newv0, newv1);
                 insertAfter(newSpan, prev);
             }
         }
@@ -219,12 +287,10 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
             span->setV1(newminv1);
 
             // insert 2 new spans
-            auto newLHS = new IntSpan(spanMin, min - 1, sv0, sv1);
-            _mgr->revAllocate(newLHS);
+            auto newLHS = IntSpan::revNew(_mgr, spanMin, min - 1, sv0, sv1);
             insertAfter(newLHS, prev);
             findPrevForward(max + 1, prev);
-            auto newRHS = new IntSpan(max + 1, spanMax, sv0, sv1);
-            _mgr->revAllocate(newRHS);
+            auto newRHS = IntSpan::revNew(_mgr, max + 1, spanMax, sv0, sv1);
             insertAfter(newRHS, prev);
         }
 #ifdef DEBUG_UNIT
@@ -265,8 +331,7 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
     else
     {
         int minSpanMax = minSpan->max();
-        IntSpan* newSpan = new IntSpan(min, minSpanMax, newminv0, newminv1);
-        _mgr->revAllocate(newSpan);
+        IntSpan* newSpan = IntSpan::revNew(_mgr, min, minSpanMax, newminv0, newminv1);
         findPrevForward(minSpanMax + 1, prev);
         insertAfter(newSpan, prev);
         minSpan->setMax(min - 1);
@@ -302,8 +367,7 @@ DiscreteTimetableDomain::add(int min, int max, int v0, int v1)
     else
     {
         int maxSpanMin = maxSpan->min();
-        IntSpan* newSpan = new IntSpan(maxSpanMin, max, newmaxv0, newmaxv1);
-        _mgr->revAllocate(newSpan);
+        IntSpan* newSpan = IntSpan::revNew(_mgr, maxSpanMin, max, newmaxv0, newmaxv1);
         findPrevForward(maxSpanMin, prev);
         insertAfter(newSpan, prev);
         maxSpan->setMin(max + 1);
@@ -11,6 +11,30 @@ CLS_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+   Change to required and/or provided capacity over a time window.
+
+   \see DiscreteTimetableDomain::add(const tt_window_vector_t&)
+   \ingroup cls
+*/
+struct TimetableWindow
+{
+    int min;    /**< start of window */
+    int max;    /**< end of window */
+    int reqCap; /**< addition to required capacity (may be negative) */
+    int prvCap; /**< addition to provided capacity (may be negative) */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   A \c std::vector of TimetableWindow%s.
+   \ingroup cls
+*/
+using tt_window_vector_t = std::vector<TimetableWindow>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    DiscreteTimetable domain.
 
@@ -54,6 +78,16 @@ public:
     */
     uint_t add(int min, int max, int reqCap, int prvCap);
 
+    /**
+       Add required and/or provided capacity over a series of time windows.
+       The windows must be sorted and must not overlap.  Compared to calling
+       add(int,int,int,int) for each window, this saves a skip-list descent per window
+       (each search starts where the previous window's update left off).
+       \param windows windows to update
+       \return minimum available capacity in the updated windows
+    */
+    uint_t add(const tt_window_vector_t& windows);
+
     /// \name Capacity Expressions
     //@{
     /** Add capacity-expression. */
@@ -104,6 +138,8 @@ private:
     void init();
     void deInit();
 
+    uint_t add(int min, int max, int v0, int v1, clp::IntSpan** prev);
+
 private:
     clp::IntExp** _capExps;
     uint_t* _capExpCounts;
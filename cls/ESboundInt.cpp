@@ -100,6 +100,7 @@ ESboundInt::registerEvents()
     {
         return;
     }
+    _act->acquireBreakList();
     breakList->addDomainBound(this);
 }
 
@@ -121,6 +122,7 @@ ESboundInt::allocateCapacity()
     // zero processing-time => nothing else to do
     if (_act->processingTime() == 0)
     {
+        _act->releaseBreakList();
         return;
     }
 
@@ -129,12 +131,16 @@ ESboundInt::allocateCapacity()
     breakList->setDeferRemoves(true);
     findForward(_bound, ef, true);
     breakList->setDeferRemoves(false);
+    _act->releaseBreakList();
 
     // allocation failed?!
     if (_bound == int_t_max)
     {
         throw FailEx(_name + ": allocation failed");
     }
+
+    // update discrete timetables (one batch per resource)
+    _act->allocateDiscrete();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -511,7 +517,8 @@ ESboundInt::findForward(int& es, int& ef, bool allocate)
                 {
                     // move cspans[i] out of the way
                     _cspans[i] = (CompositeSpan*)_cspans[i]->prev()->prev();
-                    _resources[i]->allocate(t, overlapMax, multiple * _caps[i], _act, _prs[i]);
+                    _resources[i]->allocate(t, overlapMax, multiple * _caps[i], _act, _prs[i],
+                                            nullptr, uint_t_max, false);
                 }
             }
 
@@ -29,7 +29,7 @@ ESboundTimetable::allocateCapacity()
     _res->allocate(es, ef, cap, _act);
     if (_res->isUnary() && ((cap == 0) || (cap == 100)))
     {
-        _res->actsByStartTime().insert(_act);
+        _res->unaryTimetable().add(_act, es, ef, cap);
     }
 }
 
@@ -45,7 +45,7 @@ ESboundTimetable::deallocateCapacity()
     _res->deallocate(es, ef, cap, _act);
     if (_res->isUnary() && ((cap == 0) || (cap == 100)))
     {
-        _res->actsByStartTime().erase(_act);
+        _res->unaryTimetable().remove(_act);
     }
 }
 
@@ -57,7 +57,16 @@ ESboundTimetable::allocateCapacity(int t1, int t2)
     uint_t cap = capacity();
     // _act is only useful for composite resource, so it will be ignored later anyway
     _res->allocate(t1, t2, cap, _act);
-    // no need to update _res->actsByStartTime (this function is only for shifting ef)
+    // extend _act's interval in the unary timetable (this function is only for shifting ef)
+    if (_res->isUnary() && ((cap == 0) || (cap == 100)))
+    {
+        auto& utt = _res->unaryTimetable();
+        uint_t idx = utt.find(_act);
+        if (idx != uint_t_max)
+        {
+            utt.move(_act, utt.min(idx), utl::max(utt.max(idx), t2));
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,11 +76,15 @@ ESboundTimetable::deallocateCapacity(int t1, int t2)
 {
     uint_t cap = capacity();
     _res->deallocate(t1, t2, cap, _act);
-    // re-insert _act in _res->actsByStartTime
+    // move _act's start in the unary timetable
     if (_res->isUnary() && ((cap == 0) || (cap == 100)))
     {
-        _res->actsByStartTime().erase(_act);
-        _res->actsByStartTime().insert(_act);
+        auto& utt = _res->unaryTimetable();
+        uint_t idx = utt.find(_act);
+        if (idx != uint_t_max)
+        {
+            utt.move(_act, t2 + 1, utl::max(utt.max(idx), t2 + 1));
+        }
     }
 }
 
@@ -115,12 +128,40 @@ ESboundTimetable::find()
             continue;
         }
 
+        // unary resource -> skip over the activities that overlap [_bound,ef]
+        if (_capExp == nullptr)
+        {
+            auto& utt = _res->unaryTimetable();
+            uint_t idx = utt.findFirstOverlap(_bound, ef);
+            if ((idx != uint_t_max) && (utt.activity(idx) != _act))
+            {
+                _bound = utt.max(idx) + 1;
+                cal->findForward(_bound, ef, pt);
+                span = _tt->find(_bound);
+                continue;
+            }
+        }
+
         bool capacityOK = ((span->v0() == _ttv0) && (span->v1() == _ttv1));
 
         // found workable es,ef ?
         if (capacityOK && (ef <= ttmax))
         {
-            goto succeed;
+            if (_res->setupTimes() == nullptr)
+            {
+                goto succeed;
+            }
+
+            // leave room for sequence-dependent setups with the neighboring activities
+            int setupBound = _res->setupBound(_act, _bound, ef);
+            if (setupBound == _bound)
+            {
+                goto succeed;
+            }
+            _bound = setupBound;
+            cal->findForward(_bound, ef, pt);
+            span = _tt->find(_bound);
+            continue;
         }
 
         _bound = ttmax + 1;
@@ -68,8 +68,8 @@ IntActivity::initRequirements()
             resCaps.push_back(cres->serialId());
             resCaps.push_back(cap);
         }
-        capExpMgr->add(resCaps);
-        _breakList = capExpMgr->find(resCaps);
+        // note: the CapExp isn't materialized until it's needed (see breakList)
+        _capExp = capExpMgr->add(resCaps);
     }
 
     // update _allResIds, and update discrete resources' maxCap
@@ -131,27 +131,37 @@ IntActivity::addAllocation(uint_t resId, uint_t min, uint_t max)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void
-IntActivity::deallocate()
+IntActivity::allocateDiscrete()
 {
     auto resourcesArray = schedule()->resourcesArray();
     for (uint_t i = 0; i != _allocationsSize; ++i)
     {
-        auto allocs = _allocations[i];
-        if (allocs == nullptr)
+        if (!getWindows(i))
             continue;
         auto res = resourcesArray[i];
         auto dres = utl::cast<DiscreteResource>(res);
 
-        // deallocate
-        uint_t lim = allocs->size();
-        for (uint_t j = 0; j < lim; j += 2)
-        {
-            int st = allocs->get(j);
-            int et = allocs->get(j + 1);
+        // allocate capacity (composite timetables were updated during allocation)
+        dres->allocate(_windows, nullptr, false);
+    }
+}
 
-            // deallocate capacity
-            dres->deallocate(st, et, 100);
-        }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+IntActivity::deallocate()
+{
+    auto resourcesArray = schedule()->resourcesArray();
+    for (uint_t i = 0; i != _allocationsSize; ++i)
+    {
+        if (!getWindows(i))
+            continue;
+        auto allocs = _allocations[i];
+        auto res = resourcesArray[i];
+        auto dres = utl::cast<DiscreteResource>(res);
+
+        // deallocate capacity
+        dres->deallocate(_windows);
 
         // finally, clear allocations
         allocs->clear();
@@ -160,6 +170,26 @@ IntActivity::deallocate()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+bool
+IntActivity::getWindows(uint_t resId)
+{
+    auto allocs = _allocations[resId];
+    if ((allocs == nullptr) || (allocs->size() == 0))
+        return false;
+
+    _windows.clear();
+    uint_t lim = allocs->size();
+    for (uint_t j = 0; j < lim; j += 2)
+    {
+        int st = allocs->get(j);
+        int et = allocs->get(j + 1);
+        _windows.push_back(TimetableWindow{st, et, 100, 0});
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool
 IntActivity::forward() const
 {
@@ -174,16 +204,43 @@ IntActivity::forward() const
 IntExp*
 IntActivity::breakList() const
 {
+    if (_capExp != nullptr)
+    {
+        return _capExp->get();
+    }
     return _breakList;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+IntActivity::acquireBreakList()
+{
+    if (_capExp != nullptr)
+    {
+        _capExp->acquire();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+IntActivity::releaseBreakList()
+{
+    if (_capExp != nullptr)
+    {
+        _capExp->release();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 IntActivity::init()
 {
     _processingTime = uint_t_max;
     _breakList = nullptr;
+    _capExp = nullptr;
     _allocationsSize = 0;
     _allocations = nullptr;
     revarray_uint_t* nullPtr = nullptr;
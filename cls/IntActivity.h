@@ -5,6 +5,7 @@
 #include <libutl/RBtree.h>
 #include <clp/Bound.h>
 #include <cls/PtActivity.h>
+#include <cls/DiscreteTimetableDomain.h>
 #include <clp/RevArray.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -13,6 +14,7 @@ CLS_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+class CapExp;
 class CompositeResourceRequirement;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +89,13 @@ public:
     /** Add an allocation. */
     void addAllocation(uint_t resId, uint_t min, uint_t max);
 
+    /**
+       Allocate discrete capacity for all composite allocations.
+       Each DiscreteResource's timetable is updated in a single batch (rather than once per
+       allocated window).
+    */
+    void allocateDiscrete();
+
     /** Deallocate. */
     void deallocate();
     //@}
@@ -120,6 +129,12 @@ public:
     /** Get the break-list. */
     virtual clp::IntExp* breakList() const;
 
+    /** Begin observing the break-list (see CapExp::acquire). */
+    void acquireBreakList();
+
+    /** Stop observing the break-list (see CapExp::release). */
+    void releaseBreakList();
+
     /** Get allocations array. */
     void
     getAllocations(revarray_uint_t**& allocations, uint_t& size) const
@@ -142,13 +157,16 @@ public:
 private:
     void init();
     void deInit();
+    bool getWindows(uint_t resId);
 
 private:
     uint_t _processingTime;
     clp::IntExp* _breakList;
+    CapExp* _capExp;
     revarray_uint_t** _allocations;
     size_t _allocationsSize;
     utl::RBtree _compositeReqs;
+    tt_window_vector_t _windows; // scratch space for allocateDiscrete(), deallocate()
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,7 +29,7 @@ LFboundTimetable::allocateCapacity()
     _res->allocate(ls, lf, cap, _act);
     if (_res->isUnary() && ((cap == 0) || (cap == 100)))
     {
-        _res->actsByStartTime().insert(_act);
+        _res->unaryTimetable().add(_act, ls, lf, cap);
     }
 }
 
@@ -45,7 +45,7 @@ LFboundTimetable::deallocateCapacity()
     _res->deallocate(ls, lf, cap, _act);
     if (_res->isUnary() && ((cap == 0) || (cap == 100)))
     {
-        _res->actsByStartTime().erase(_act);
+        _res->unaryTimetable().remove(_act);
     }
 }
 
@@ -87,6 +87,20 @@ LFboundTimetable::find()
             continue;
         }
 
+        // unary resource -> skip over the activities that overlap [ls,_bound]
+        if (_capExp == nullptr)
+        {
+            auto& utt = _res->unaryTimetable();
+            uint_t idx = utt.findLastOverlap(ls, _bound);
+            if ((idx != uint_t_max) && (utt.activity(idx) != _act))
+            {
+                _bound = utt.min(idx) - 1;
+                cal->findBackward(_bound, ls, pt);
+                span = _tt->find(_bound);
+                continue;
+            }
+        }
+
         bool capacityOK = ((span->v0() == _ttv0) && (span->v1() == _ttv1));
 
         // found workable es,ef ?
@@ -552,8 +552,11 @@ ResourceCalendar::ptTS(uint_t pt) const
 const ResourceCalendarSpan*
 ResourceCalendar::findSpanByTime(int ts) const
 {
-    _searchSpan.setEnd(ts + 1);
-    auto it = std::lower_bound(_spans, _spansLim, &_searchSpan, ResourceCalendarSpanEndOrdering());
+    // note: no shared search key, so concurrent searches are safe
+    auto it = std::lower_bound(_spans, _spansLim, ts + 1,
+                               [](const ResourceCalendarSpan* span, int end) {
+                                   return (span->end() < end);
+                               });
     ASSERTD(it != _spansLim);
     auto span = *it;
     return span;
@@ -564,9 +567,10 @@ ResourceCalendar::findSpanByTime(int ts) const
 const ResourceCalendarSpan*
 ResourceCalendar::findSpanByPt(int pt) const
 {
-    _searchSpan.setCumPt(pt);
-    auto it =
-        std::lower_bound(_spans, _spansLim, &_searchSpan, ResourceCalendarSpanCumPtOrdering());
+    auto it = std::lower_bound(_spans, _spansLim, (uint_t)pt,
+                               [](const ResourceCalendarSpan* span, uint_t cumPt) {
+                                   return (span->cumPt() < cumPt);
+                               });
     ASSERTD(it != _spansLim);
     auto span = *it;
     return span;
@@ -229,7 +229,6 @@ private:
     uint_t _maxPT;
     int _maxTS;
     clp::IntVar* _breakList;
-    mutable ResourceCalendarSpan _searchSpan;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,10 @@
+#include "libcls.h"
+#include "ResourceSetupTimes.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL_ABC(cls::ResourceSetupTimes);
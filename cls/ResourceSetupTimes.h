@@ -0,0 +1,52 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cls/Activity.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Sequence-dependent setup times for a unary DiscreteResource (abstract).
+
+   The setup time for a pair of activities is the idle time the resource needs between the end
+   of the first activity and the start of the second.  When a DiscreteResource has setup times,
+   ESboundTimetable only accepts a start time that leaves room for the setups with the
+   activities that are already scheduled before and after it.
+
+   \see DiscreteResource::setupBound
+   \ingroup cls
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ResourceSetupTimes : public utl::Object
+{
+    UTL_CLASS_DECL_ABC(ResourceSetupTimes, utl::Object);
+
+public:
+    /**
+       Get the setup time (in time slots) between two activities.
+       \param lhsAct activity that is processed first
+       \param rhsAct activity that is processed next
+    */
+    virtual uint_t setupTime(const Activity* lhsAct, const Activity* rhsAct) const = 0;
+
+private:
+    void
+    init()
+    {
+    }
+    void
+    deInit()
+    {
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_END;
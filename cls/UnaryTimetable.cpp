@@ -0,0 +1,256 @@
+#include "libcls.h"
+#include "UnaryTimetable.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+CLP_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(cls::UnaryTimetable);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+UnaryTimetable::upperBound(int t) const
+{
+    uint_t lo = 0;
+    uint_t hi = _size;
+    while (lo < hi)
+    {
+        uint_t mid = (lo + hi) / 2;
+        if (_mins[mid] <= t)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+UnaryTimetable::find(const Activity* act) const
+{
+    // search from the back (recently scheduled activities are usually there)
+    for (uint_t idx = _size; idx-- != 0;)
+    {
+        if (_acts[idx] == act)
+        {
+            return idx;
+        }
+    }
+    return uint_t_max;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+UnaryTimetable::findFirstOverlap(int min, int max) const
+{
+    uint_t idx = upperBound(min);
+
+    // busy interval that starts at or before min, and covers it?
+    for (uint_t i = idx; i-- != 0;)
+    {
+        if (_caps[i] == 0)
+        {
+            continue;
+        }
+        if (_maxs[i] >= min)
+        {
+            return i;
+        }
+        break;
+    }
+
+    // busy interval that starts in (min,max]?
+    for (; (idx != _size) && (_mins[idx] <= max); ++idx)
+    {
+        if (_caps[idx] > 0)
+        {
+            return idx;
+        }
+    }
+    return uint_t_max;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+UnaryTimetable::findLastOverlap(int min, int max) const
+{
+    // busy intervals don't overlap, so the latest one that starts at or before max is the only
+    // candidate
+    for (uint_t idx = upperBound(max); idx-- != 0;)
+    {
+        if (_caps[idx] == 0)
+        {
+            continue;
+        }
+        if (_maxs[idx] >= min)
+        {
+            return idx;
+        }
+        break;
+    }
+    return uint_t_max;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::add(Activity* act, int min, int max, uint_t cap)
+{
+    ASSERTD(find(act) == uint_t_max);
+    if (_size == _allocSize)
+    {
+        grow();
+    }
+
+    // find the insertion point (order by start time, then by id for repeatability)
+    uint_t id = act->id();
+    uint_t idx = upperBound(min);
+    while ((idx != 0) && (_mins[idx - 1] == min) && (_acts[idx - 1]->id() > id))
+    {
+        --idx;
+    }
+
+    // shift the tail, and insert
+    saveTail(idx);
+    _mgr->revSet(_size);
+    for (uint_t i = _size; i != idx; --i)
+    {
+        _mins[i] = _mins[i - 1];
+        _maxs[i] = _maxs[i - 1];
+        _caps[i] = _caps[i - 1];
+        _acts[i] = _acts[i - 1];
+    }
+    _mins[idx] = min;
+    _maxs[idx] = max;
+    _caps[idx] = cap;
+    _acts[idx] = act;
+    ++_size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::remove(const Activity* act)
+{
+    uint_t idx = find(act);
+    if (idx == uint_t_max)
+    {
+        return;
+    }
+
+    // shift the tail over act's position
+    saveTail(idx);
+    _mgr->revSet(_size);
+    --_size;
+    for (uint_t i = idx; i != _size; ++i)
+    {
+        _mins[i] = _mins[i + 1];
+        _maxs[i] = _maxs[i + 1];
+        _caps[i] = _caps[i + 1];
+        _acts[i] = _acts[i + 1];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::move(const Activity* act, int min, int max)
+{
+    uint_t idx = find(act);
+    if (idx == uint_t_max)
+    {
+        return;
+    }
+
+    // start time is unchanged -> the order is unchanged
+    if (min == _mins[idx])
+    {
+        _mgr->revSetIndirect(_maxs, idx);
+        _maxs[idx] = max;
+        return;
+    }
+
+    // re-insert
+    uint_t cap = _caps[idx];
+    remove(act);
+    add(const_cast<Activity*>(act), min, max, cap);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::init()
+{
+    _mgr = nullptr;
+    _size = 0;
+    _allocSize = 0;
+    _mins = nullptr;
+    _maxs = nullptr;
+    _caps = nullptr;
+    _acts = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::deInit()
+{
+    delete[] _mins;
+    delete[] _maxs;
+    delete[] _caps;
+    delete[] _acts;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::grow()
+{
+    // saved entries are restored through the array pointers, so re-allocation is safe
+    size_t minSize = utl::max((size_t)16, _allocSize + 1);
+    size_t allocSize = _allocSize;
+    utl::arrayGrow(_mins, allocSize, minSize);
+    allocSize = _allocSize;
+    utl::arrayGrow(_maxs, allocSize, minSize);
+    allocSize = _allocSize;
+    utl::arrayGrow(_caps, allocSize, minSize);
+    allocSize = _allocSize;
+    utl::arrayGrow(_acts, allocSize, minSize);
+    _allocSize = allocSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+UnaryTimetable::saveTail(uint_t idx)
+{
+    if (idx == _size)
+    {
+        return;
+    }
+    uint_t size = _size - idx;
+    _mgr->revSetIndirect(_mins, idx, size);
+    _mgr->revSetIndirect(_maxs, idx, size);
+    _mgr->revSetIndirect(_caps, idx, size);
+    _mgr->revSetIndirect(_acts, idx, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_END;
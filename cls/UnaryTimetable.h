@@ -0,0 +1,185 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <clp/Manager.h>
+#include <cls/Activity.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Unary resource timetable.
+
+   A unary resource's activities can't overlap, so its schedule is simply a sequence of busy
+   intervals.  UnaryTimetable keeps the activities that are allocated on the resource in a sorted
+   array (ordered by start time, then by activity id), along with the time span that each one
+   occupies, and the capacity it requires (an activity that requires no capacity is in the
+   sequence, but it doesn't make the resource busy).
+
+   The array is reversible: each modification saves the part of the array that it shifts (an
+   activity that's added at the end shifts nothing), so backtracking restores the sequence
+   without rebuilding it.
+
+   Gap search uses the busy intervals to skip over the activities that are already scheduled
+   (see ESboundTimetable and LFboundTimetable), and the sequence gives direct access to the
+   order of the resource's activities.
+
+   \see DiscreteResource
+   \see DiscreteTimetable
+   \ingroup cls
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class UnaryTimetable : public utl::Object
+{
+    UTL_CLASS_DECL(UnaryTimetable, utl::Object);
+    UTL_CLASS_NO_COPY;
+
+public:
+    using iterator = Activity* const*;
+
+public:
+    /// \name Accessors (const)
+    //@{
+    /** Get the manager. */
+    clp::Manager*
+    manager() const
+    {
+        return _mgr;
+    }
+
+    /** Get the number of activities. */
+    uint_t
+    size() const
+    {
+        return _size;
+    }
+
+    /** Empty? */
+    bool
+    empty() const
+    {
+        return (_size == 0);
+    }
+
+    /** Get begin iterator (over the activities, in order of start time). */
+    iterator
+    begin() const
+    {
+        return _acts;
+    }
+
+    /** Get end iterator. */
+    iterator
+    end() const
+    {
+        return _acts + _size;
+    }
+
+    /** Get the activity at the given position. */
+    Activity*
+    activity(uint_t idx) const
+    {
+        ASSERTD(idx < _size);
+        return _acts[idx];
+    }
+
+    /** Get the start of the interval at the given position. */
+    int
+    min(uint_t idx) const
+    {
+        ASSERTD(idx < _size);
+        return _mins[idx];
+    }
+
+    /** Get the end of the interval at the given position. */
+    int
+    max(uint_t idx) const
+    {
+        ASSERTD(idx < _size);
+        return _maxs[idx];
+    }
+
+    /** Does the interval at the given position make the resource busy? */
+    bool
+    busy(uint_t idx) const
+    {
+        ASSERTD(idx < _size);
+        return (_caps[idx] > 0);
+    }
+    //@}
+
+    /// \name Accessors (non-const)
+    //@{
+    /** Set the manager. */
+    void
+    setManager(clp::Manager* mgr)
+    {
+        _mgr = mgr;
+    }
+    //@}
+
+    /// \name Query
+    //@{
+    /** Get the position of the first interval that starts after t. */
+    uint_t upperBound(int t) const;
+
+    /** Find the given activity's position (uint_t_max if it's not in the sequence). */
+    uint_t find(const Activity* act) const;
+
+    /**
+       Find the earliest busy interval that overlaps [min,max].
+       \return position of the interval (uint_t_max if [min,max] is free)
+    */
+    uint_t findFirstOverlap(int min, int max) const;
+
+    /**
+       Find the latest busy interval that overlaps [min,max].
+       \return position of the interval (uint_t_max if [min,max] is free)
+    */
+    uint_t findLastOverlap(int min, int max) const;
+    //@}
+
+    /// \name Modification
+    //@{
+    /**
+       Add an activity.
+       \param act the activity
+       \param min start of the time span it occupies
+       \param max end of the time span it occupies
+       \param cap required capacity
+    */
+    void add(Activity* act, int min, int max, uint_t cap);
+
+    /** Remove an activity (if it's in the sequence). */
+    void remove(const Activity* act);
+
+    /** Move an activity to a new time span (if it's in the sequence). */
+    void move(const Activity* act, int min, int max);
+    //@}
+
+private:
+    void init();
+    void deInit();
+
+    void grow();
+    void saveTail(uint_t idx);
+
+private:
+    clp::Manager* _mgr;
+    uint_t _size;
+    size_t _allocSize;
+    int* _mins;
+    int* _maxs;
+    uint_t* _caps;
+    Activity** _acts;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLS_NS_END;
@@ -75,7 +75,7 @@ AltJobMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool sin
     // choose an item
     uint_t groupIdx = this->varIdx();
     _moveGroupIdx = _stringBase + groupIdx;
-    _moveJobIdx = string[_moveGroupIdx];
+    _moveJobIdx = string.get(_moveGroupIdx);
     JobGroup* group = _jobGroups[groupIdx];
 
     // choose a job to activate
@@ -113,7 +113,7 @@ AltJobMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool sin
         if (jobIdx >= _moveJobIdx)
             jobIdx++;
     }
-    string[_moveGroupIdx] = jobIdx;
+    string.set(_moveGroupIdx, jobIdx);
 
     ASSERTD(jobIdx != _moveJobIdx);
 #ifdef DEBUG_UNIT
@@ -152,7 +152,7 @@ AltJobMutate::undo()
     if (_moveGroupIdx != uint_t_max)
     {
         ASSERTD(_moveJobIdx != uint_t_max);
-        string[_moveGroupIdx] = _moveJobIdx;
+        string.set(_moveGroupIdx, _moveJobIdx);
         JobGroup* group = _jobGroups[_moveGroupIdx - _stringBase]; // groupIdx
         // specially for AltJobMutate
         // because partial propagation from processPlan->serialId
@@ -151,7 +151,7 @@ void
 AltJobSelector::setJobs(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
     ASSERTD(_config != nullptr);
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     Manager* mgr = context->manager();
     uint_t numGroups = _jobGroups.size();
     for (uint_t i = 0; i < numGroups; ++i)
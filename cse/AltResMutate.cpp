@@ -86,7 +86,7 @@ AltResMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool sin
     uint_t resGroupReqIdx = this->varIdx();
     cls::DiscreteResourceRequirement* resGroupReq = _resGroupReqs[resGroupReqIdx];
     _moveResGroupReqIdx = _stringBase + resGroupReqIdx;
-    _moveResIdx = string[_moveResGroupReqIdx];
+    _moveResIdx = string.get(_moveResGroupReqIdx);
 
     // choose resource
     uint_t numResources = resGroupReq->resCapPtsSet().size();
@@ -122,7 +122,7 @@ AltResMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool sin
         if (resIdx >= _moveResIdx)
             ++resIdx;
     }
-    string[_moveResGroupReqIdx] = resIdx;
+    string.set(_moveResGroupReqIdx, resIdx);
     uint_t resId = resGroupReq->resIdxCapPts(resIdx)->resourceId();
 
 #ifdef DEBUG_UNIT
@@ -162,7 +162,7 @@ AltResMutate::undo()
     if (_moveResGroupReqIdx != uint_t_max)
     {
         ASSERTD(_moveResIdx != uint_t_max);
-        string[_moveResGroupReqIdx] = _moveResIdx;
+        string.set(_moveResGroupReqIdx, _moveResIdx);
     }
 }
 
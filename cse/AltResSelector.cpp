@@ -173,7 +173,7 @@ void
 AltResSelector::setSelectedResources(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
     ASSERTD(_config != nullptr);
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     Manager* mgr = context->manager();
     uint_t numResGroupReqs = _resGroupReqs.size();
     for (uint_t i = 0; i < numResGroupReqs; ++i)
@@ -30,6 +30,66 @@ UTL_CLASS_IMPL(cse::AuditReport);
 
 CSE_NS_BEGIN;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// AuditArena /////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+AuditArena::clear()
+{
+    deInit();
+    _slabs.clear();
+    init();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+AuditArena::init()
+{
+    _slabPtr = nullptr;
+    _slabLim = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+AuditArena::deInit()
+{
+    // destroy objects in reverse order of creation
+    for (auto it = _objects.rbegin(); it != _objects.rend(); ++it)
+    {
+        auto obj = *it;
+        obj->~Object();
+    }
+    _objects.clear();
+    for (auto slab : _slabs)
+    {
+        delete[] slab;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void*
+AuditArena::allocate(size_t size)
+{
+    // keep every object aligned on a 16-byte boundary
+    size = (size + 15) & ~(size_t)15;
+    ASSERTD(size <= slabSize);
+    if (size > (size_t)(_slabLim - _slabPtr))
+    {
+        // slabs come from new[] (suitably aligned for any fundamental type)
+        auto slab = new byte_t[slabSize];
+        _slabs.push_back(slab);
+        _slabPtr = slab;
+        _slabLim = slab + slabSize;
+    }
+    auto ptr = _slabPtr;
+    _slabPtr += size;
+    return ptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// InterestPeriodInfo /////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,6 +426,10 @@ ResourceCostReport::copy(const utl::Object& rhs)
 {
     ASSERTD(rhs.isA(ResourceCostReport));
     const ResourceCostReport& rcr = (const ResourceCostReport&)rhs;
+    deInit();
+    _costs.clear();
+    _workHours.clear();
+    _arena = nullptr;
     _id = rcr._id;
     copyVector(_costs, rcr._costs);
     copyVector(_workHours, rcr._workHours);
@@ -378,8 +442,10 @@ ResourceCostReport::serialize(Stream& stream, uint_t io, uint_t)
 {
     if (io == io_rd)
     {
-        deleteCont(_costs);
-        deleteCont(_workHours);
+        deInit();
+        _costs.clear();
+        _workHours.clear();
+        _arena = nullptr;
     }
     utl::serialize(_id, stream, io);
     lut::serialize(_costs, stream, io);
@@ -400,8 +466,7 @@ void
 ResourceCostReport::init()
 {
     _id = uint_t_max;
-    deleteCont(_costs);
-    deleteCont(_workHours);
+    _arena = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,6 +474,11 @@ ResourceCostReport::init()
 void
 ResourceCostReport::deInit()
 {
+    // infos are owned by the arena?
+    if (_arena != nullptr)
+    {
+        return;
+    }
     deleteCont(_costs);
     deleteCont(_workHours);
 }
@@ -422,9 +492,12 @@ LatenessCostReport::copy(const utl::Object& rhs)
 {
     ASSERTD(rhs.isA(LatenessCostReport));
     const LatenessCostReport& lcr = (const LatenessCostReport&)rhs;
+    deInit();
+    _costs.clear();
+    _arena = nullptr;
     _id = lcr._id;
     _name = lcr._name;
-    _costs = lcr._costs;
+    copyVector(_costs, lcr._costs);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -434,7 +507,9 @@ LatenessCostReport::serialize(Stream& stream, uint_t io, uint_t)
 {
     if (io == io_rd)
     {
-        deleteCont(_costs);
+        deInit();
+        _costs.clear();
+        _arena = nullptr;
     }
     utl::serialize(_id, stream, io);
     lut::serialize(_name, stream, io);
@@ -446,7 +521,7 @@ LatenessCostReport::serialize(Stream& stream, uint_t io, uint_t)
 void
 LatenessCostReport::init()
 {
-    deleteCont(_costs);
+    _arena = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,6 +529,11 @@ LatenessCostReport::init()
 void
 LatenessCostReport::deInit()
 {
+    // infos are owned by the arena?
+    if (_arena != nullptr)
+    {
+        return;
+    }
     deleteCont(_costs);
 }
 
@@ -466,9 +546,12 @@ JobOverheadCostReport::copy(const utl::Object& rhs)
 {
     ASSERTD(rhs.isA(JobOverheadCostReport));
     const JobOverheadCostReport& lcr = (const JobOverheadCostReport&)rhs;
+    deInit();
+    _costs.clear();
+    _arena = nullptr;
     _id = lcr._id;
     _name = lcr._name;
-    _costs = lcr._costs;
+    copyVector(_costs, lcr._costs);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -478,7 +561,9 @@ JobOverheadCostReport::serialize(Stream& stream, uint_t io, uint_t)
 {
     if (io == io_rd)
     {
-        deleteCont(_costs);
+        deInit();
+        _costs.clear();
+        _arena = nullptr;
     }
     utl::serialize(_id, stream, io);
     lut::serialize(_name, stream, io);
@@ -490,7 +575,7 @@ JobOverheadCostReport::serialize(Stream& stream, uint_t io, uint_t)
 void
 JobOverheadCostReport::init()
 {
-    deleteCont(_costs);
+    _arena = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -498,6 +583,11 @@ JobOverheadCostReport::init()
 void
 JobOverheadCostReport::deInit()
 {
+    // infos are owned by the arena?
+    if (_arena != nullptr)
+    {
+        return;
+    }
     deleteCont(_costs);
 }
 
@@ -511,6 +601,12 @@ AuditReport::copy(const utl::Object& rhs)
     ASSERTD(rhs.isA(AuditReport));
     const AuditReport& ar = (const AuditReport&)rhs;
 
+    // copies are allocated from the heap
+    clear();
+    delete _arena;
+    _arena = nullptr;
+    _sections = ar._sections;
+
     _name = ar._name;
     _originTime = ar._originTime;
     _horizonTime = ar._horizonTime;
@@ -536,6 +632,13 @@ AuditReport::copy(const utl::Object& rhs)
 void
 AuditReport::serialize(Stream& stream, uint_t io, uint_t)
 {
+    // de-serialized objects are allocated from the heap
+    if (io == io_rd)
+    {
+        clear();
+        delete _arena;
+        _arena = nullptr;
+    }
     lut::serialize(_name, stream, io);
     lut::serialize(_originTime, stream, io);
     lut::serialize(_horizonTime, stream, io);
@@ -557,6 +660,56 @@ AuditReport::serialize(Stream& stream, uint_t io, uint_t)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+AuditReport::clear()
+{
+    // arena owns the objects -> destroy them all at once
+    if (_arena != nullptr)
+    {
+        _interestPeriods.clear();
+        _resInfos.clear();
+        _resourceCosts.clear();
+        _latenessCosts.clear();
+        _joboverheadCosts.clear();
+        _fixedCosts.clear();
+        _overheadCosts.clear();
+        _interestCosts.clear();
+        _resourceUsages.clear();
+        _componentInfos.clear();
+        _operationInfos.clear();
+        _resourceSequenceCosts.clear();
+        _arena->clear();
+        return;
+    }
+
+    deleteCont(_interestPeriods);
+    deleteMapSecond(_resInfos);
+    deleteMapSecond(_resourceCosts);
+    deleteMapSecond(_latenessCosts);
+    deleteMapSecond(_joboverheadCosts);
+    deleteMapSecond(_fixedCosts);
+    deleteCont(_overheadCosts);
+    deleteCont(_interestCosts);
+    deleteCont(_resourceUsages);
+    deleteCont(_componentInfos);
+    deleteMapSecond(_operationInfos);
+    deleteCont(_resourceSequenceCosts);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+AuditReport::useArena()
+{
+    ASSERTD(_componentInfos.empty() && _operationInfos.empty());
+    if (_arena == nullptr)
+    {
+        _arena = new AuditArena();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 AuditReport::setName(std::string name)
 {
@@ -604,7 +757,8 @@ AuditReport::resourceCost(uint_t id)
     resourceReports_t::iterator i = _resourceCosts.find(id);
     if (i == _resourceCosts.end())
     {
-        report = new ResourceCostReport();
+        report = create<ResourceCostReport>();
+        report->setArena(_arena);
         report->setId(id);
         _resourceCosts.insert(resourceReports_t::value_type(id, report));
     }
@@ -624,7 +778,8 @@ AuditReport::latenessCost(uint_t id)
     latenessReports_t::iterator i = _latenessCosts.find(id);
     if (i == _latenessCosts.end())
     {
-        report = new LatenessCostReport();
+        report = create<LatenessCostReport>();
+        report->setArena(_arena);
         report->setId(id);
         _latenessCosts.insert(latenessReports_t::value_type(id, report));
     }
@@ -644,7 +799,8 @@ AuditReport::joboverheadCost(uint_t id)
     joboverheadReports_t::iterator i = _joboverheadCosts.find(id);
     if (i == _joboverheadCosts.end())
     {
-        report = new JobOverheadCostReport();
+        report = create<JobOverheadCostReport>();
+        report->setArena(_arena);
         report->setId(id);
         _joboverheadCosts.insert(joboverheadReports_t::value_type(id, report));
     }
@@ -660,6 +816,8 @@ AuditReport::joboverheadCost(uint_t id)
 void
 AuditReport::init()
 {
+    _arena = nullptr;
+    _sections = audit_report;
     _name = "";
     _originTime = -1;
     _horizonTime = -1;
@@ -682,18 +840,8 @@ AuditReport::init()
 void
 AuditReport::deInit()
 {
-    deleteCont(_interestPeriods);
-    deleteMapSecond(_resInfos);
-    deleteMapSecond(_resourceCosts);
-    deleteMapSecond(_latenessCosts);
-    deleteMapSecond(_joboverheadCosts);
-    deleteMapSecond(_fixedCosts);
-    deleteCont(_overheadCosts);
-    deleteCont(_interestCosts);
-    deleteCont(_resourceUsages);
-    deleteCont(_componentInfos);
-    deleteMapSecond(_operationInfos);
-    deleteCont(_resourceSequenceCosts);
+    clear();
+    delete _arena;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
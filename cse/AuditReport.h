@@ -4,6 +4,89 @@
 
 CSE_NS_BEGIN;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Audit section (see TotalCostEvaluator::setAuditSections).
+
+   An audit only collects the sections it was asked for, so a client that only wants (say) the
+   resource costs doesn't pay for the rest.
+*/
+enum audit_section_t
+{
+    audit_text = 1,      /**< audit text (for the requested report sections) */
+    audit_resources = 2, /**< resource infos, costs, usages, and resource-sequence costs */
+    audit_jobs = 4,      /**< operation infos, and lateness, job-overhead and fixed costs */
+    audit_periods = 8,   /**< interest periods, and overhead and interest costs */
+    audit_report = 14,   /**< all report sections (no text) */
+    audit_all = 15       /**< all report sections and text */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// AuditArena //////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Bump allocator for the objects that make up an AuditReport.
+
+   An audit of a large schedule creates hundreds of thousands of small info objects.  Carving
+   them out of large slabs (instead of allocating each one from the heap) makes the audit
+   cheaper to build and to destroy.  Objects are only released all at once (see clear).
+
+   \see AuditReport::create
+   \ingroup cse
+*/
+class AuditArena
+{
+public:
+    /** Constructor. */
+    AuditArena()
+    {
+        init();
+    }
+
+    /** Destructor. */
+    ~AuditArena()
+    {
+        deInit();
+    }
+
+    /** Create a new object of the given type. */
+    template <class T>
+    T*
+    create()
+    {
+        auto obj = ::new (allocate(sizeof(T))) T();
+        _objects.push_back(obj);
+        return obj;
+    }
+
+    /** Destroy all objects and release their storage. */
+    void clear();
+
+    /** Get the number of live objects. */
+    size_t
+    numObjects() const
+    {
+        return _objects.size();
+    }
+
+public:
+    /** Size of a slab. */
+    static const size_t slabSize = 256 * 1024;
+
+private:
+    void init();
+    void deInit();
+    void* allocate(size_t size);
+
+private:
+    std::vector<byte_t*> _slabs;
+    byte_t* _slabPtr;
+    byte_t* _slabLim;
+    std::vector<utl::Object*> _objects;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // InterestPeriodInfo //////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,6 +424,16 @@ public:
     virtual void serialize(utl::Stream& stream, uint_t io, uint_t mode = utl::ser_default);
 
 public:
+    /**
+       Set the arena that owns this report's infos (they aren't deleted with the report).
+       \see AuditReport::create
+    */
+    void
+    setArena(AuditArena* arena)
+    {
+        _arena = arena;
+    }
+
     uint_t
     getId() const
     {
@@ -381,6 +474,7 @@ private:
     uint_t _id;              // resource id
     rcInfos_t _costs;        // cost info for this resource
     wkhrsInfos_t _workHours; // work hours for this reosurce
+    AuditArena* _arena;      // owner of the infos (if any)
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -401,6 +495,16 @@ public:
     virtual void serialize(utl::Stream& stream, uint_t io, uint_t mode = utl::ser_default);
 
 public:
+    /**
+       Set the arena that owns this report's infos (they aren't deleted with the report).
+       \see AuditReport::create
+    */
+    void
+    setArena(AuditArena* arena)
+    {
+        _arena = arena;
+    }
+
     uint_t
     getId() const
     {
@@ -442,6 +546,8 @@ private:
     void deInit();
 
 private:
+    // owner of the infos (if any)
+    AuditArena* _arena;
     // work order id;
     uint_t _id;
     // work order name;
@@ -468,6 +574,16 @@ public:
     virtual void serialize(utl::Stream& stream, uint_t io, uint_t mode = utl::ser_default);
 
 public:
+    /**
+       Set the arena that owns this report's infos (they aren't deleted with the report).
+       \see AuditReport::create
+    */
+    void
+    setArena(AuditArena* arena)
+    {
+        _arena = arena;
+    }
+
     uint_t
     getId() const
     {
@@ -509,6 +625,8 @@ private:
     void deInit();
 
 private:
+    // owner of the infos (if any)
+    AuditArena* _arena;
     // work order id;
     uint_t _id;
     // work order name;
@@ -534,6 +652,37 @@ public:
 
     virtual void serialize(utl::Stream& stream, uint_t io, uint_t mode = utl::ser_default);
 
+    /** Remove all infos and reports. */
+    void clear();
+
+    /**
+       Allocate this report's infos and reports from an arena (see create).
+       The report must be empty, and it stays in this mode until it's copied or de-serialized.
+    */
+    void useArena();
+
+    /** Create a new info or report of the given type (owned by the report's arena, if any). */
+    template <class T>
+    T*
+    create()
+    {
+        return (_arena == nullptr) ? new T() : _arena->create<T>();
+    }
+
+    /** Get the audit sections this report contains (see audit_section_t). */
+    uint_t
+    sections() const
+    {
+        return _sections;
+    }
+
+    /** Set the audit sections this report contains (see audit_section_t). */
+    void
+    setSections(uint_t sections)
+    {
+        _sections = sections;
+    }
+
     std::string
     getName() const
     {
@@ -729,6 +878,11 @@ private:
     void deInit();
 
 private:
+    // owner of infos and reports (if any)
+    AuditArena* _arena;
+    // audit sections
+    uint_t _sections;
+
     std::string _name;
 
     // scheduler config
@@ -85,10 +85,10 @@ CapMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool single
               << "varSucRate:" << this->varP() << ", idx:" << actIdx;
 #endif
     _moveCapIdx = actIdx;
-    _moveCap = string[_stringBase + _moveCapIdx];
+    _moveCap = string.get(_stringBase + _moveCapIdx);
 
     // choose activity cap
-    uint_t oldCap = string[_stringBase + _moveCapIdx];
+    uint_t oldCap = string.get(_stringBase + _moveCapIdx);
     uint_t cap;
     if (singleStep)
     {
@@ -120,7 +120,7 @@ CapMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool single
         if (cap >= oldCap)
             cap++;
     }
-    string[_stringBase + _moveCapIdx] = cap;
+    string.set(_stringBase + _moveCapIdx, cap);
 
     ASSERTD(cap != _moveCap);
 #ifdef DEBUG_UNIT
@@ -155,7 +155,7 @@ CapMutate::undo()
     if (_moveCapIdx != uint_t_max)
     {
         ASSERTD(_moveCap != uint_t_max);
-        string[_stringBase + _moveCapIdx] = _moveCap;
+        string.set(_stringBase + _moveCapIdx, _moveCap);
     }
 }
 
@@ -172,7 +172,7 @@ void
 CapSelector::setCaps(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
     ASSERTD(_config != nullptr);
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     uint_t numActs = _acts.size();
     for (uint_t i = 0; i < numActs; ++i)
     {
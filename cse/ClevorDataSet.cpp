@@ -2,6 +2,7 @@
 #include <libutl/BufferedFDstream.h>
 #include <clp/BoundPropagator.h>
 #include <cls/CompositeResourceRequirement.h>
+#include <cls/DiscreteResourceEnergyCt.h>
 #include <cls/DiscreteResourceRequirement.h>
 #include <cls/EFbound.h>
 #include <cls/EFboundInt.h>
@@ -121,7 +122,12 @@ ClevorDataSet::copy(const Object& rhs)
     DataSet::copy(ds);
     delete _config;
     _config = lut::clone(ds._config);
+    _numThreads = ds._numThreads;
     copySet(_jobs, ds._jobs);
+    for (auto job : _jobs)
+    {
+        job->dataSet() = this;
+    }
     copySet(_resources, ds._resources);
     copySet(_resGroups, ds._resGroups);
     copySet(_rsls, ds._rsls);
@@ -143,6 +149,9 @@ ClevorDataSet::modelBuild_0(Schedule* schedule)
     _schedulingOriginTS = _config->schedulingOriginTimeSlot();
     _horizonTS = _config->horizonTimeSlot();
 
+    // resource calendars don't depend on the manager -> compile them while the model is built
+    startCalendars();
+
     // compute static views (phase 0-0)
     createViews_0_0();
 
@@ -433,6 +442,402 @@ ClevorDataSet::findResourceSequenceList(uint_t id) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+uint_t
+ClevorDataSet::decompose(std::vector<ClevorDataSet*>& dataSets) const
+{
+    // nodes: jobs, then resources, then resource-groups
+    std::map<uint_t, uint_t> jobNodes, opJobNodes, resNodes, resGroupNodes;
+    uint_t numJobs = _jobs.size();
+    uint_t numNodes = 0;
+    for (auto job : _jobs)
+    {
+        jobNodes[job->id()] = numNodes;
+        for (auto op : *job)
+        {
+            opJobNodes[op->id()] = numNodes;
+        }
+        ++numNodes;
+    }
+    for (auto res : _resources)
+    {
+        resNodes[res->id()] = numNodes++;
+    }
+    for (auto resGroup : _resGroups)
+    {
+        resGroupNodes[resGroup->id()] = numNodes++;
+    }
+
+    // disjoint sets of nodes (the lowest node in a set is its root, so jobs are roots)
+    uint_vector_t parents(numNodes);
+    for (uint_t node = 0; node != numNodes; ++node)
+    {
+        parents[node] = node;
+    }
+    auto findRoot = [&parents](uint_t node) {
+        while (parents[node] != node)
+        {
+            parents[node] = parents[parents[node]];
+            node = parents[node];
+        }
+        return node;
+    };
+    auto connect = [&](const std::map<uint_t, uint_t>& lhsNodes, uint_t lhsId,
+                       const std::map<uint_t, uint_t>& rhsNodes, uint_t rhsId) {
+        auto lhsIt = lhsNodes.find(lhsId);
+        auto rhsIt = rhsNodes.find(rhsId);
+        if ((lhsIt == lhsNodes.end()) || (rhsIt == rhsNodes.end()))
+        {
+            return;
+        }
+        uint_t lhsRoot = findRoot(lhsIt->second);
+        uint_t rhsRoot = findRoot(rhsIt->second);
+        if (lhsRoot < rhsRoot)
+        {
+            parents[rhsRoot] = lhsRoot;
+        }
+        else
+        {
+            parents[lhsRoot] = rhsRoot;
+        }
+    };
+
+    // resource-group -> its resources
+    for (auto resGroup : _resGroups)
+    {
+        for (auto resId : resGroup->resIds())
+        {
+            connect(resGroupNodes, resGroup->id(), resNodes, resId);
+        }
+    }
+
+    // composite resource -> its resource-group
+    for (auto res : _resources)
+    {
+        if (res->isA(CompositeResource))
+        {
+            auto cres = utl::cast<CompositeResource>(res);
+            connect(resNodes, cres->id(), resGroupNodes, cres->resourceGroupId());
+        }
+    }
+
+    // job -> resources and resource-groups required by its ops
+    for (auto job : _jobs)
+    {
+        for (auto op : *job)
+        {
+            uint_t numResReqs = op->numResReqs();
+            for (uint_t i = 0; i != numResReqs; ++i)
+            {
+                auto resReq = op->getResReq(i);
+                connect(jobNodes, job->id(), resNodes, resReq->resourceId());
+                auto pr = resReq->preferredResources();
+                if (pr != nullptr)
+                {
+                    for (auto resId : pr->resIds())
+                    {
+                        connect(jobNodes, job->id(), resNodes, resId);
+                    }
+                }
+            }
+            uint_t numResGroupReqs = op->numResGroupReqs();
+            for (uint_t i = 0; i != numResGroupReqs; ++i)
+            {
+                auto resGroupReq = op->getResGroupReq(i);
+                connect(jobNodes, job->id(), resGroupNodes, resGroupReq->resourceGroupId());
+            }
+        }
+    }
+
+    // precedence-ct -> jobs of its ops
+    for (auto pct : _pcts)
+    {
+        connect(opJobNodes, pct->lhsOpId(), opJobNodes, pct->rhsOpId());
+    }
+
+    // job-group -> its jobs
+    for (auto jobGroup : _jobGroups)
+    {
+        auto& groupJobs = jobGroup->jobs();
+        for (auto job : groupJobs)
+        {
+            connect(jobNodes, (*groupJobs.begin())->id(), jobNodes, job->id());
+        }
+    }
+
+    // number the sub-problems (in order of their first job)
+    uint_vector_t rootComponents(numNodes, uint_t_max);
+    uint_t numComponents = 0;
+    for (uint_t node = 0; node != numJobs; ++node)
+    {
+        uint_t root = findRoot(node);
+        if (rootComponents[root] == uint_t_max)
+        {
+            rootComponents[root] = numComponents++;
+        }
+    }
+    if (numComponents <= 1)
+    {
+        return numComponents;
+    }
+    auto nodeComponent = [&](uint_t node) {
+        uint_t component = rootComponents[findRoot(node)];
+        return (component == uint_t_max) ? 0 : component;
+    };
+
+    // make a data set for each sub-problem
+    uint_t firstDataSet = dataSets.size();
+    for (uint_t i = 0; i != numComponents; ++i)
+    {
+        auto config = _config->clone();
+        config->setDecompose(false);
+        auto dataSet = new ClevorDataSet();
+        dataSet->set(config);
+        dataSets.push_back(dataSet);
+    }
+    auto componentDataSet = [&](uint_t node) {
+        return dataSets[firstDataSet + nodeComponent(node)];
+    };
+    uint_t node = 0;
+    for (auto job : _jobs)
+    {
+        componentDataSet(node++)->add(job->clone());
+    }
+    for (auto res : _resources)
+    {
+        componentDataSet(node++)->add(res->clone());
+    }
+    for (auto resGroup : _resGroups)
+    {
+        componentDataSet(node++)->add(resGroup->clone());
+    }
+    for (auto pct : _pcts)
+    {
+        auto it = opJobNodes.find(pct->lhsOpId());
+        auto dataSet = dataSets[firstDataSet];
+        if (it != opJobNodes.end())
+        {
+            dataSet = componentDataSet(it->second);
+        }
+        dataSet->add(pct->clone());
+    }
+    for (uint_t i = 0; i != numComponents; ++i)
+    {
+        for (auto rsl : _rsls)
+        {
+            dataSets[firstDataSet + i]->add(rsl->clone());
+        }
+    }
+
+    // job-groups refer to the sub-problem's copies of their jobs
+    for (auto jobGroup : _jobGroups)
+    {
+        auto& groupJobs = jobGroup->jobs();
+        auto dataSet = dataSets[firstDataSet];
+        if (!groupJobs.empty())
+        {
+            dataSet = componentDataSet(jobNodes[(*groupJobs.begin())->id()]);
+        }
+        job_set_pref_t jobs;
+        Job* activeJob = nullptr;
+        for (auto job : groupJobs)
+        {
+            auto dataSetJob = dataSet->findJob(job->id());
+            if (dataSetJob == nullptr)
+            {
+                continue;
+            }
+            jobs.insert(dataSetJob);
+            if (job == jobGroup->activeJob())
+            {
+                activeJob = dataSetJob;
+            }
+        }
+        auto group = jobGroup->clone();
+        group->setJobs(jobs, activeJob);
+        dataSet->_jobGroups.insert(group);
+    }
+
+    return numComponents;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ClevorDataSet::merge(const std::vector<ClevorDataSet*>& dataSets)
+{
+    clearProblemData();
+    for (auto dataSet : dataSets)
+    {
+        // jobs & ops take their hot state back from the sub-problem's arrays (which are freed
+        // along with the sub-problem)
+        for (auto op : dataSet->_ops)
+        {
+            op->setHot(nullptr);
+        }
+        for (auto job : dataSet->_jobs)
+        {
+            job->setHot(nullptr);
+        }
+        dataSet->_sopsHot.clear();
+
+        for (auto job : dataSet->_jobs)
+        {
+            add(job);
+        }
+        _jobGroups.insert(dataSet->_jobGroups.begin(), dataSet->_jobGroups.end());
+        _pcts.insert(_pcts.end(), dataSet->_pcts.begin(), dataSet->_pcts.end());
+        _resources.insert(dataSet->_resources.begin(), dataSet->_resources.end());
+        _resGroups.insert(dataSet->_resGroups.begin(), dataSet->_resGroups.end());
+
+        // each sub-problem has a copy of every resource-sequence-list
+        for (auto rsl : dataSet->_rsls)
+        {
+            if (!_rsls.insert(rsl).second)
+            {
+                delete rsl;
+            }
+        }
+
+        // the objects are ours now
+        dataSet->_jobs.clear();
+        dataSet->_jobGroups.clear();
+        dataSet->_pcts.clear();
+        dataSet->_resources.clear();
+        dataSet->_resGroups.clear();
+        dataSet->_rsls.clear();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ClevorDataSet*
+ClevorDataSet::horizonWindow(const ClevorDataSet* prefix,
+                             time_t windowStart,
+                             time_t windowEnd) const
+{
+    // the previous window's ops that start before this window are frozen
+    time_t originTime = _config->originTime();
+    auto config = _config->clone();
+    config->setRollingHorizonDuration(0);
+    if (windowStart > originTime)
+    {
+        uint_t windowOffset = (uint_t)(windowStart - originTime);
+        config->setAutoFreezeDuration(utl::max(config->autoFreezeDuration(), windowOffset));
+    }
+    auto dataSet = new ClevorDataSet();
+    dataSet->set(config);
+
+    // find the jobs that can start in the window
+    std::map<uint_t, const Job*> opJobs;
+    std::set<const Job*> windowJobs;
+    for (auto job : _jobs)
+    {
+        for (auto op : *job)
+        {
+            opJobs[op->id()] = job;
+        }
+        bool inPrefix = (prefix != nullptr) && (prefix->findJob(job->id()) != nullptr);
+        if (inPrefix || (windowEnd == -1) || (jobEarliestStart(job, originTime) < windowEnd))
+        {
+            windowJobs.insert(job);
+        }
+    }
+
+    // a job with a predecessor outside the window can't start in it either
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (auto pct : _pcts)
+        {
+            auto lhsIt = opJobs.find(pct->lhsOpId());
+            auto rhsIt = opJobs.find(pct->rhsOpId());
+            if ((lhsIt == opJobs.end()) || (rhsIt == opJobs.end()))
+            {
+                continue;
+            }
+            auto rhsJob = rhsIt->second;
+            if ((windowJobs.find(lhsIt->second) == windowJobs.end()) &&
+                (windowJobs.find(rhsJob) != windowJobs.end()) &&
+                ((prefix == nullptr) || (prefix->findJob(rhsJob->id()) == nullptr)))
+            {
+                windowJobs.erase(rhsJob);
+                changed = true;
+            }
+        }
+    }
+
+    // clone the window's objects (jobs from the previous window keep its scheduling results)
+    for (auto job : _jobs)
+    {
+        if (windowJobs.find(job) == windowJobs.end())
+        {
+            continue;
+        }
+        auto prefixJob = (prefix == nullptr) ? nullptr : prefix->findJob(job->id());
+        dataSet->add(((prefixJob == nullptr) ? job : prefixJob)->clone());
+    }
+    for (auto pct : _pcts)
+    {
+        auto lhsIt = opJobs.find(pct->lhsOpId());
+        auto rhsIt = opJobs.find(pct->rhsOpId());
+        if ((lhsIt != opJobs.end()) && (rhsIt != opJobs.end()) &&
+            (windowJobs.find(lhsIt->second) != windowJobs.end()) &&
+            (windowJobs.find(rhsIt->second) != windowJobs.end()))
+        {
+            dataSet->add(pct->clone());
+        }
+    }
+    for (auto res : _resources)
+    {
+        dataSet->add(res->clone());
+    }
+    for (auto resGroup : _resGroups)
+    {
+        dataSet->add(resGroup->clone());
+    }
+    for (auto rsl : _rsls)
+    {
+        dataSet->add(rsl->clone());
+    }
+    return dataSet;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+time_t
+ClevorDataSet::jobEarliestStart(const Job* job, time_t originTime)
+{
+    // earliest start of any op (an op in progress means the job is in progress)
+    time_t earliestStart = -1;
+    for (auto op : *job)
+    {
+        if (op->type() == op_summary)
+        {
+            continue;
+        }
+        if (op->status() != opstatus_unstarted)
+        {
+            return originTime;
+        }
+        time_t opEarliestStart = originTime;
+        for (auto uct : op->unaryCts())
+        {
+            if ((uct->type() == uct_startAt) || (uct->type() == uct_startNoSoonerThan))
+            {
+                opEarliestStart = utl::max(opEarliestStart, uct->time());
+            }
+        }
+        if ((earliestStart == -1) || (opEarliestStart < earliestStart))
+        {
+            earliestStart = opEarliestStart;
+        }
+    }
+    return (earliestStart == -1) ? originTime : earliestStart;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 ClevorDataSet::clearProblemData()
 {
@@ -460,6 +865,7 @@ ClevorDataSet::init()
     _opsDecSD.setOwner(false);
     _summaryOpsIncSD.setOwner(false);
     _minCostHeuristics = nullptr;
+    _numThreads = 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,6 +873,11 @@ ClevorDataSet::init()
 void
 ClevorDataSet::deInit()
 {
+    if (_calendarThread.joinable())
+    {
+        _calendarThread.join();
+    }
+    deleteCont(_calendars);
     delete _config;
     deleteCont(_jobs);
     deleteCont(_jobGroups);
@@ -557,6 +968,42 @@ ClevorDataSet::createViews_1()
             }
         }
     }
+
+    createHotViews();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ClevorDataSet::createHotViews()
+{
+    // the hot state of each job and op moves into one contiguous array (ordered like _jobs/_ops),
+    // so the per-iteration passes over jobs & ops (scheduling, operators, evaluation) don't have
+    // to touch the rest of each object
+    std::vector<JobHot> jobsHot(_jobs.size());
+    uint_t idx = 0;
+    for (auto job : _jobs)
+    {
+        job->setHot(&jobsHot[idx++]);
+    }
+    _jobsHot.swap(jobsHot);
+
+    std::vector<JobOpHot> opsHot(_ops.size());
+    idx = 0;
+    for (auto op : _ops)
+    {
+        op->setHot(&opsHot[idx++]);
+        op->hot().jobHot = &op->job()->hot();
+    }
+    _opsHot.swap(opsHot);
+
+    // schedulable ops (a subset of _ops, so _sopsHot is in increasing address order)
+    _sopsHot.clear();
+    _sopsHot.reserve(_sops.size());
+    for (auto op : _sops)
+    {
+        _sopsHot.push_back(&op->hot());
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -564,6 +1011,12 @@ ClevorDataSet::createViews_1()
 void
 ClevorDataSet::setRSLs()
 {
+    // compile the rules of each resource-sequence-list
+    for (auto rsl : _rsls)
+    {
+        rsl->compile();
+    }
+
     res_set_id_t::iterator resIt;
     for (resIt = _resources.begin(); resIt != _resources.end(); ++resIt)
     {
@@ -594,6 +1047,64 @@ ClevorDataSet::propagate()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+ClevorDataSet::startCalendars()
+{
+    // discard calendars from an unfinished model build
+    if (_calendarThread.joinable())
+    {
+        _calendarThread.join();
+    }
+    deleteCont(_calendars);
+    _calendarEx = nullptr;
+
+    // one calendar per discrete resource
+    _calendarRes.clear();
+    for (auto res : _resources)
+    {
+        if (dynamic_cast<DiscreteResource*>(res) != nullptr)
+        {
+            _calendarRes.push_back(res);
+        }
+    }
+    _calendars.resize(_calendarRes.size(), nullptr);
+
+    // compile the calendars on a background thread (which shares the work with a thread pool),
+    // writing each calendar to its own slot
+    _calendarThread = std::thread([this]() {
+        try
+        {
+            ThreadPool pool(utl::min(_numThreads, (uint_t)_calendarRes.size()));
+            pool.run(_calendarRes.size(), [this](uint_t resIdx, uint_t) {
+                auto cseDres = static_cast<const DiscreteResource*>(_calendarRes[resIdx]);
+                _calendars[resIdx] = cseDres->makeCurrentCalendar(_config);
+            });
+        }
+        catch (...)
+        {
+            _calendarEx = std::current_exception();
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ClevorDataSet::finishCalendars()
+{
+    ASSERTD(_calendarThread.joinable());
+    _calendarThread.join();
+    if (_calendarEx != nullptr)
+    {
+        auto ex = _calendarEx;
+        _calendarEx = nullptr;
+        deleteCont(_calendars);
+        std::rethrow_exception(ex);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 ClevorDataSet::modelBuildActivities_0()
 {
@@ -1184,17 +1695,17 @@ ClevorDataSet::modelBuildDiscreteResourceCalendars()
     ResourceCalendarMgr* calMgr = _schedule->calendarMgr();
     calMgr->setHorizonTS(_horizonTS);
 
-    res_set_id_t::const_iterator it;
-    for (it = _resources.begin(); it != _resources.end(); ++it)
+    // wait for the calendars (see startCalendars)
+    finishCalendars();
+
+    // timetables and the calendar mgr belong to the manager -> apply the calendars serially
+    uint_t numRes = _calendarRes.size();
+    for (uint_t resIdx = 0; resIdx != numRes; ++resIdx)
     {
-        cse::Resource* cseRes = *it;
-        if (dynamic_cast<DiscreteResource*>(cseRes) == nullptr)
-        {
-            continue;
-        }
-        const cse::DiscreteResource* cseDres = (DiscreteResource*)cseRes;
+        auto cseDres = static_cast<const DiscreteResource*>(_calendarRes[resIdx]);
         cls::DiscreteResource* clsDres = cseDres->clsResource();
-        ResourceCalendar* resCal = cseDres->makeCurrentCalendar(_config);
+        ResourceCalendar* resCal = _calendars[resIdx];
+        _calendars[resIdx] = nullptr;
 
         // add provided capacity
         ResourceCalendar::iterator spanIt;
@@ -1209,6 +1720,8 @@ ClevorDataSet::modelBuildDiscreteResourceCalendars()
         clsDres->setCalendar(resCal);
         clsDres->initialize();
     }
+    _calendarRes.clear();
+    _calendars.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1326,6 +1839,18 @@ ClevorDataSet::modelBuildResourceCts()
             continue;
         }
     }
+
+    // energetic reasoning (optional)
+    if (_config->energeticReasoning())
+    {
+        modelBuildEnergyCts();
+    }
+
+    // sequence-dependent setups during construction (optional)
+    if (_config->setupsInConstruction() && _config->forward())
+    {
+        modelBuildSetups();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1555,6 +2080,93 @@ ClevorDataSet::modelBuildCompositeResourceCts()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+ClevorDataSet::modelBuildEnergyCts()
+{
+    // resource-id => energetic-reasoning constraint
+    std::map<uint_t, cls::DiscreteResourceEnergyCt*> energyCts;
+
+    jobop_set_id_t::const_iterator it;
+    for (it = _ops.begin(); it != _ops.end(); ++it)
+    {
+        JobOp* op = *it;
+
+        // skip non-breakable or frozen op
+        if (!op->breakable() || op->frozen())
+        {
+            continue;
+        }
+
+        BrkActivity* act = op->brkact();
+        ASSERTD(act != nullptr);
+
+        // spin through resource requirements
+        // (resource-group requirements don't mandate any particular resource)
+        uint_t numResReqs = op->numResReqs();
+        for (uint_t i = 0; i < numResReqs; ++i)
+        {
+            cse::ResourceRequirement* cseResReq = op->getResReq(i);
+            uint_t resId = cseResReq->resourceId();
+            cse::Resource* cseRes = findResource(resId);
+            ASSERTD(cseRes != nullptr);
+
+            // skip non-discrete resource
+            if (!cseRes->isA(DiscreteResource))
+            {
+                continue;
+            }
+
+            // skip requirement without defined cap/pt
+            const ResourceCapPts* resCapPts = op->resCapPtsAdj(resId);
+            if ((resCapPts == nullptr) || (resCapPts->numCapPts() == 0))
+            {
+                continue;
+            }
+
+            // find or create the resource's constraint
+            auto& energyCt = energyCts[resId];
+            if (energyCt == nullptr)
+            {
+                auto clsDres = (cls::DiscreteResource*)cseRes->clsResource();
+                energyCt = new cls::DiscreteResourceEnergyCt(clsDres);
+            }
+            energyCt->add(act, resCapPts);
+        }
+    }
+
+    // post constraints
+    for (auto& pair : energyCts)
+    {
+        _mgr->add(pair.second);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ClevorDataSet::modelBuildSetups()
+{
+    for (auto res : _resources)
+    {
+        // skip non-discrete resource, or one without a resource-sequence-list
+        auto dres = dynamic_cast<DiscreteResource*>(res);
+        if ((dres == nullptr) || (dres->sequenceList() == nullptr))
+        {
+            continue;
+        }
+
+        // sequence delays only apply to unary resources
+        auto clsRes = dres->clsResource();
+        if ((clsRes == nullptr) || !clsRes->isUnary())
+        {
+            continue;
+        }
+        clsRes->setSetupTimes(new ResourceSequenceSetups(dres->sequenceList(), _config));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 ClevorDataSet::modelBuildHeuristics()
 {
@@ -2,7 +2,9 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <lut/ThreadPool.h>
 #include <gop/DataSet.h>
+#include <cls/ResourceCalendar.h>
 #include <cse/Job.h>
 #include <cse/JobGroup.h>
 #include <cse/PrecedenceCt.h>
@@ -37,9 +39,28 @@ public:
 
     /// \name Propagation Model
     //@{
-    /** Initialize the model (phase 0). */
+    /**
+       Initialize the model (phase 0).
+       Resource calendars only depend on the problem data, so they are compiled in parallel (on a
+       background thread) while activities and precedence links are added to the manager.  They
+       are applied to the resources' timetables in phase 1.
+    */
     void modelBuild_0(cls::Schedule* schedule);
 
+    /** Get the number of threads that compile the resource calendars. */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
+
+    /** Set the number of threads that compile the resource calendars. */
+    void
+    setNumThreads(uint_t numThreads)
+    {
+        _numThreads = utl::max(numThreads, (uint_t)1);
+    }
+
     /** Initialize the model (phase 1). */
     void modelBuild_1();
 
@@ -61,6 +82,50 @@ public:
     }
     //@}
 
+    /// \name Decomposition
+    //@{
+    /**
+       Find the independent sub-problems.
+
+       Jobs are connected by precedence-cts and job-groups, and by the resources that their ops
+       require (directly, through a resource-group, or through a composite resource).  Each
+       connected set of jobs is a sub-problem, whose data set holds clones of the jobs, and of the
+       resources, resource-groups, job-groups and precedence-cts that belong to them (resources
+       that no job requires go to the first sub-problem).  Each sub-problem gets a copy of every
+       resource-sequence-list.
+
+       \return number of sub-problems (data sets are only made if there are two or more)
+       \param dataSets (out) data set for each sub-problem
+    */
+    uint_t decompose(std::vector<ClevorDataSet*>& dataSets) const;
+
+    /**
+       Replace the problem data with that of the given sub-problems (see decompose), taking
+       ownership of their objects (so the sub-problems' scheduling results become ours).
+    */
+    void merge(const std::vector<ClevorDataSet*>& dataSets);
+
+    /**
+       Make the data set for a rolling-horizon window.
+
+       A job is in the window if it's in the previous window, if it's in progress, or if its ops
+       can start before the window's end (considering their unary-cts), unless one of its
+       predecessors can't.  The window's jobs are cloned (from the previous window if they're
+       in it, so they keep its scheduling results), along with the precedence-cts between them,
+       and every resource, resource-group and resource-sequence-list.  The auto-freeze duration
+       is extended to the window's start, so the previous window's ops that start before it are
+       frozen.
+
+       
+eturn new data set
+       \param prefix data set for the previous window (nullptr for the first window)
+       \param windowStart start of the window
+       \param windowEnd end of the window (-1 for the last window, which has every job)
+    */
+    ClevorDataSet*
+    horizonWindow(const ClevorDataSet* prefix, time_t windowStart, time_t windowEnd) const;
+    //@}
+
     /// \name Add objects
     //@{
     /** Set configuration. */
@@ -179,6 +244,27 @@ public:
         return _sops;
     }
 
+    /** Get the hot state of all ops (ordered like ops()). */
+    const std::vector<JobOpHot>&
+    opsHot() const
+    {
+        return _opsHot;
+    }
+
+    /** Get the hot state of the schedulable ops (ordered like sops()). */
+    const std::vector<JobOpHot*>&
+    sopsHot() const
+    {
+        return _sopsHot;
+    }
+
+    /** Get the hot state of all jobs (ordered like jobs()). */
+    const std::vector<JobHot>&
+    jobsHot() const
+    {
+        return _jobsHot;
+    }
+
     /** Get list of ops ordered by decreasing successor-id. */
     const utl::TRBtree<JobOp>&
     opsDecSD() const
@@ -244,13 +330,21 @@ private:
 
     int timeToTimeSlot(time_t t) const;
 
+    // rolling horizon
+    static time_t jobEarliestStart(const Job* job, time_t originTime);
+
     void createViews_0_0();
     void createViews_0_1();
     void createViews_1();
+    void createHotViews();
     void setRSLs();
 
     void propagate();
 
+    // resource calendars (compiled in the background)
+    void startCalendars();
+    void finishCalendars();
+
     // model: phase 0
     void modelBuildActivities_0();
     void modelBuildPrecedenceCts_0();
@@ -266,6 +360,8 @@ private:
     void modelBuildDiscreteResourceCts();
     void modelBuildResourceGroupCts();
     void modelBuildCompositeResourceCts();
+    void modelBuildEnergyCts();
+    void modelBuildSetups();
     void modelBuildHeuristics();
 
 private:
@@ -292,8 +388,20 @@ private:
     utl::TRBtree<JobOp> _opsDecSD;
     utl::TRBtree<JobOp> _summaryOpsIncSD;
 
+    // hot views (the Job/JobOp hot state records, stored contiguously)
+    std::vector<JobOpHot> _opsHot;
+    std::vector<JobOpHot*> _sopsHot;
+    std::vector<JobHot> _jobsHot;
+
     // heuristics
     MinCostHeuristics* _minCostHeuristics;
+
+    // resource calendars
+    uint_t _numThreads;
+    std::thread _calendarThread;
+    std::exception_ptr _calendarEx;
+    std::vector<const Resource*> _calendarRes;
+    std::vector<cls::ResourceCalendar*> _calendars;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2,6 +2,7 @@
 #include <libutl/Time.h>
 #include <libutl/BufferedFDstream.h>
 #include "DiscreteResource.h"
+#include "Job.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -19,6 +20,7 @@ CLS_NS_USE;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 UTL_CLASS_IMPL(cse::ResourceSequenceRuleApplication);
+UTL_CLASS_IMPL(cse::ResourceSequenceSetups);
 UTL_CLASS_IMPL(cse::DiscreteResource);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +42,34 @@ ResourceSequenceRuleApplication::copy(const Object& rhs)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+uint_t
+ResourceSequenceSetups::setupTime(const Activity* lhsAct, const Activity* rhsAct) const
+{
+    auto lhsOp = dynamic_cast<const JobOp*>(lhsAct->owner());
+    auto rhsOp = dynamic_cast<const JobOp*>(rhsAct->owner());
+    if ((lhsOp == nullptr) || (rhsOp == nullptr))
+    {
+        return 0;
+    }
+
+    // no setup between ops of the same job that have the same sequenceId
+    uint_t lhsOpSeqId = lhsOp->sequenceId();
+    uint_t rhsOpSeqId = rhsOp->sequenceId();
+    if ((lhsOpSeqId == rhsOpSeqId) && (lhsOp->job()->id() == rhsOp->job()->id()))
+    {
+        return 0;
+    }
+
+    auto rule = _rsl->findRule(lhsOpSeqId, rhsOpSeqId);
+    if (rule == nullptr)
+    {
+        return 0;
+    }
+    return _config->durationToTimeSlot(rule->delay());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 DiscreteResource::copy(const Object& rhs)
 {
@@ -246,7 +276,7 @@ DiscreteResource::applyDefaultCalendar(const SchedulerConfiguration* config,
                                        cls::ResourceCalendar* inSched) const
 {
     time_t originTime = config->originTime();
-    time_t roundedOriginTime = Time(originTime).roundDown(tm_day);
+    time_t roundedOriginTime = time_midnight(originTime);
     time_t horizonTime = config->horizonTime();
 
     ResourceCalendar::iterator it;
@@ -4,6 +4,7 @@
 
 #include <cls/DiscreteResource.h>
 #include <cls/ResourceCalendar.h>
+#include <cls/ResourceSetupTimes.h>
 #include <cse/JobOp.h>
 #include <cse/Resource.h>
 #include <cse/ResourceCost.h>
@@ -68,6 +69,59 @@ private:
 
 using rsra_vector_t = std::vector<ResourceSequenceRuleApplication>;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ResourceSequenceSetups //////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Setup times given by a ResourceSequenceList's delays.
+
+   The delay for a pair of ops is the delay of the matching rule (see
+   ResourceSequenceList::findRule), except that ops of the same job that have the same
+   op-sequence-id need no setup.  This is the same delay that
+   SchedulingContext::postResourceSequenceDelays would impose after construction.
+
+   \ingroup cse
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ResourceSequenceSetups : public cls::ResourceSetupTimes
+{
+    UTL_CLASS_DECL(ResourceSequenceSetups, cls::ResourceSetupTimes);
+    UTL_CLASS_NO_COPY;
+
+public:
+    /**
+       Constructor.
+       \param rsl resource-sequence-list
+       \param config scheduler configuration (to convert delays to time slots)
+    */
+    ResourceSequenceSetups(const ResourceSequenceList* rsl, const SchedulerConfiguration* config)
+    {
+        _rsl = rsl;
+        _config = config;
+    }
+
+    virtual uint_t setupTime(const cls::Activity* lhsAct, const cls::Activity* rhsAct) const;
+
+private:
+    void
+    init()
+    {
+        _rsl = nullptr;
+        _config = nullptr;
+    }
+    void
+    deInit()
+    {
+    }
+
+private:
+    const ResourceSequenceList* _rsl;
+    const SchedulerConfiguration* _config;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // DiscreteResource ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,7 +308,11 @@ public:
         _detailedCalendar = cal;
     }
 
-    /** Make current calendar. */
+    /**
+       Make current calendar.
+       Only reads the resource and the configuration, so calendars for different resources can be
+       made concurrently (see ClevorDataSet::modelBuild_0).
+    */
     cls::ResourceCalendar* makeCurrentCalendar(const SchedulerConfiguration* config) const;
 
     /** Get the cls-resource. */
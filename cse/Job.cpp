@@ -73,9 +73,9 @@ Job::copy(const Object& rhs)
     const Job& job = (const Job&)rhs;
     clear();
     _id = job._id;
-    _serialId = job._serialId;
+    _hot->serialId = job._hot->serialId;
     _preference = job._preference;
-    _active = job._active;
+    _hot->active = job._hot->active;
     _workOrderIds = job._workOrderIds;
     _name = job._name;
     _groupId = job._groupId;
@@ -87,7 +87,7 @@ Job::copy(const Object& rhs)
     }
     _itemId = job._itemId;
     _itemQuantity = job._itemQuantity;
-    _makespan = job._makespan;
+    _hot->makespan = job._hot->makespan;
     _frozenMakespan = 0;
     _releaseTime = job._releaseTime;
     _dueTime = job._dueTime;
@@ -123,23 +123,23 @@ Job::serialize(Stream& stream, uint_t io, uint_t)
     utl::serialize(_releaseTime, stream, io);
     utl::serialize(_dueTime, stream, io);
 
-    // set _active based on _status when read
-    // change _status based on _active when write
+    // set active flag based on _status when read
+    // change _status based on active flag when write
     if (io == io_rd)
     {
         utl::serialize((uint_t&)_status, stream, io);
         if ((_status == jobstatus_inactive) || (_status == jobstatus_undefined))
         {
-            _active = false;
+            _hot->active = false;
         }
         else
         {
-            _active = true;
+            _hot->active = true;
         }
     }
     else
     {
-        if (_active == false)
+        if (_hot->active == false)
             _status = jobstatus_inactive;
         utl::serialize((uint_t&)_status, stream, io);
     }
@@ -235,10 +235,28 @@ Job::sopsRemove(JobOp* op)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Job::setHot(JobHot* hot)
+{
+    if (hot == nullptr)
+    {
+        hot = &_ownHot;
+    }
+    if (hot == _hot)
+    {
+        return;
+    }
+    *hot = *_hot;
+    hot->job = this;
+    _hot = hot;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 Job::scheduleClear()
 {
-    _makespan = _frozenMakespan;
+    _hot->makespan = _frozenMakespan;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,11 +273,11 @@ Job::calculateMakespan(bool forward)
         ASSERT(act != nullptr);
         if (forward)
         {
-            _makespan = utl::max(_makespan, act->ef() + 1);
+            _hot->makespan = utl::max(_hot->makespan, act->ef() + 1);
         }
         else
         {
-            _makespan = utl::max(_makespan, act->lf() + 1);
+            _hot->makespan = utl::max(_hot->makespan, act->lf() + 1);
         }
         if (op->frozen())
         {
@@ -277,15 +295,32 @@ Job::calculateMakespan(bool forward)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+int
+Job::makespanLowerBound() const
+{
+    int makespan = _frozenMakespan;
+    for (auto op : _ops)
+    {
+        auto act = op->activity();
+        if (act != nullptr)
+        {
+            makespan = utl::max(makespan, act->ef() + 1);
+        }
+    }
+    return makespan;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 uint_t
 Job::tardiness() const
 {
-    if ((_dueTime == -1) || (_makespan < _dueTime))
+    if ((_dueTime == -1) || (_hot->makespan < _dueTime))
     {
         return 0;
     }
 
-    return (_makespan - _dueTime);
+    return (_hot->makespan - _dueTime);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,8 +440,8 @@ String
 Job::toString() const
 {
     MemStream str;
-    str << "job: " << _id << ", active:" << Bool(_active).toString() << ", status:" << _status
-        << ", rlsT:";
+    str << "job: " << _id << ", active:" << Bool(_hot->active).toString()
+        << ", status:" << _status << ", rlsT:";
     if (_releaseTime == -1)
     {
         str << "null";
@@ -425,13 +460,13 @@ Job::toString() const
         str << _dueTime;
     }
     str << ", sid:";
-    if (_serialId == uint_t_max)
+    if (_hot->serialId == uint_t_max)
     {
         str << "null";
     }
     else
     {
-        str << _serialId;
+        str << _hot->serialId;
     }
     str << ", itemId:";
     if (_itemId != uint_t_max)
@@ -479,15 +514,18 @@ void
 Job::init()
 {
     _dataSet = nullptr;
-    _id = _serialId = _preference = _groupId = uint_t_max;
-    _active = true;
+    _hot = &_ownHot;
+    _hot->job = this;
+    _id = _preference = _groupId = uint_t_max;
+    _hot->serialId = uint_t_max;
+    _hot->active = true;
     _precedenceBound = nullptr;
     _releaseBound = nullptr;
     _rootSummaryOp = nullptr;
 
     _itemId = uint_t_max;
     _itemQuantity = 0;
-    _makespan = 0;
+    _hot->makespan = 0;
     _frozenMakespan = 0;
     _releaseTime = -1;
     _dueTime = -1;
@@ -30,6 +30,20 @@ enum job_status_t
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+   Frequently accessed state of a Job (see JobOpHot).
+   \ingroup cse
+*/
+struct JobHot
+{
+    Job* job;        /**< the job */
+    uint_t serialId; /**< serial id */
+    int makespan;    /**< completion time */
+    bool active;     /**< active flag */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    A grouping of operations (JobOp%s) in a Schedule.
 
@@ -102,14 +116,14 @@ public:
     uint_t
     serialId() const
     {
-        return _serialId;
+        return _hot->serialId;
     }
 
     /** Get the serial-id. */
     uint_t&
     serialId()
     {
-        return _serialId;
+        return _hot->serialId;
     }
 
     /** Get the preference. */
@@ -130,23 +144,43 @@ public:
     const bool
     active() const
     {
-        return _active;
+        return _hot->active;
     }
 
     /** Get the active bool. */
     bool&
     active()
     {
-        return _active;
+        return _hot->active;
     }
 
-    /** the point to _active. */
+    /** the point to the active bool. */
     bool*
     activeP()
     {
-        return &_active;
+        return &_hot->active;
     }
 
+    /** Get the hot-state record. */
+    const JobHot&
+    hot() const
+    {
+        return *_hot;
+    }
+
+    /** Get the hot-state record. */
+    JobHot&
+    hot()
+    {
+        return *_hot;
+    }
+
+    /**
+       Move the hot-state record to the given location (owned by the data-set).
+       \param hot new record (nullptr to move it back into the job)
+    */
+    void setHot(JobHot* hot);
+
     /** Get job group id. */
     uint_t
     groupId() const
@@ -210,7 +244,7 @@ public:
     /** Prepare to generate new schedule. */
     void scheduleClear();
 
-    /** Calculate _makespan and _frozenMakespan. */
+    /** Calculate the makespan and _frozenMakespan. */
     void calculateMakespan(bool forward);
 
     /** Schedulable-jobs empty? */
@@ -267,7 +301,7 @@ public:
     int
     makespan() const
     {
-        return _makespan;
+        return _hot->makespan;
     }
 
     /** Get _frozenMakespan. */
@@ -277,6 +311,12 @@ public:
         return _frozenMakespan;
     }
 
+    /**
+       Get a lower bound on the completion time (during forward scheduling).
+       No op can finish before its current earliest-finish bound.
+    */
+    int makespanLowerBound() const;
+
     /** Get the tardiness. */
     uint_t tardiness() const;
 
@@ -552,9 +592,7 @@ public:
 protected:
     ClevorDataSet* _dataSet;
     uint_t _id;
-    uint_t _serialId;
     uint_t _preference; //for alt jobs
-    bool _active;       //indicate the selected job from alt jobs
     std::string _name;
     uint_t _groupId;
     uint_set_t _workOrderIds; //ids of mrp::workorders
@@ -570,7 +608,6 @@ protected:
 
     uint_t _itemId;       // for MRP GUI
     uint_t _itemQuantity; // for MRP GUI
-    int _makespan;
     int _frozenMakespan;
     int _releaseTime; // for MRP GUI and more
     int _dueTime;
@@ -588,6 +625,11 @@ protected:
     // predecessors, successors
     uint_t _schedulableJobsIdx;
 
+    // hot state: serial id, makespan, active flag (indicates the selected job from alt jobs)
+    // (_hot refers to _ownHot, or to our record in ClevorDataSet::jobsHot)
+    JobHot* _hot;
+    JobHot _ownHot;
+
 private:
     void init();
     void deInit();
@@ -107,6 +107,16 @@ JobGroup::setJobs(job_set_pref_t jobs, bool owner)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+JobGroup::setJobs(job_set_pref_t jobs, Job* activeJob)
+{
+    ASSERTD((activeJob == nullptr) || (jobs.find(activeJob) != jobs.end()));
+    setJobs(jobs);
+    _activeJob = activeJob;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 JobGroup::setActiveJob(uint_t jobIdx)
 {
@@ -102,6 +102,12 @@ public:
     /** set jobs. */
     void setJobs(job_set_pref_t jobs, bool owner = false);
 
+    /**
+       Set (non-owned) jobs, and the active job (one of them).
+       Unlike setActiveJob(), the jobs' active flags and serial-ids are left as they are.
+    */
+    void setJobs(job_set_pref_t jobs, cse::Job* activeJob);
+
     /** set activeJob. */
     void setActiveJob(cse::Job* job);
 
@@ -31,21 +31,23 @@ JobOp::copy(const Object& rhs)
     const JobOp& op = (const JobOp&)rhs;
     clearResReqs();
     bool saveResReqOwner = _resReqOwner;
+    JobOpHot* saveHot = _hot;
     init();
     _resReqOwner = saveResReqOwner;
+    _hot = saveHot;
 
     _id = op._id;
-    _serialId = op._serialId;
+    _hot->serialId = op._hot->serialId;
     _sequenceId = op._sequenceId;
     _name = op._name;
     _job = nullptr;
     _cost = op._cost;
-    _processingTime = op._processingTime;
+    _hot->processingTime = op._hot->processingTime;
 
     _type = op._type;
-    _status = op._status;
+    _hot->status = op._hot->status;
 
-    _frozen = op._frozen;
+    _hot->frozen = op._hot->frozen;
     _manuallyFrozen = op._manuallyFrozen;
 
     // previous scheduling result
@@ -78,10 +80,10 @@ JobOp::copy(const Object& rhs)
     _resCapPtsAdj = op._resCapPtsAdj;
 
     // schedulable-ops index
-    _schedulableOpsIdx = uint_t_max;
+    _hot->schedulableOpsIdx = uint_t_max;
 
     // activity
-    _act = op._act;
+    _hot->act = op._hot->act;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,10 +95,10 @@ JobOp::serialize(Stream& stream, uint_t io, uint_t)
     utl::serialize(_sequenceId, stream, io);
     lut::serialize(_name, stream, io);
     utl::serialize(_cost, stream, io);
-    utl::serialize(_processingTime, stream, io);
+    utl::serialize(_hot->processingTime, stream, io);
     utl::serialize((uint_t&)_type, stream, io);
-    utl::serialize((uint_t&)_status, stream, io);
-    utl::serialize(_frozen, stream, io);
+    utl::serialize((uint_t&)_hot->status, stream, io);
+    utl::serialize(_hot->frozen, stream, io);
     utl::serialize(_manuallyFrozen, stream, io);
     utl::serialize((uint_t&)_scheduledBy, stream, io);
     utl::serialize(_scheduledProcessingTime, stream, io);
@@ -132,7 +134,7 @@ JobOp::serialize(Stream& stream, uint_t io, uint_t)
 bool
 JobOp::schedulable() const
 {
-    return hasRequirements() && (_type != op_summary) && (_status != opstatus_complete);
+    return hasRequirements() && (_type != op_summary) && (_hot->status != opstatus_complete);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,11 +145,11 @@ JobOp::ignorable() const
     // not scheduled => ignorable iff completed precedenceLag
     if (!isScheduled())
     {
-        return ((_type == op_precedenceLag) && (_status == opstatus_complete));
+        return ((_type == op_precedenceLag) && (_hot->status == opstatus_complete));
     }
 
     // not complete => not ignorable
-    if (_status != opstatus_complete)
+    if (_hot->status != opstatus_complete)
     {
         return false;
     }
@@ -283,7 +285,7 @@ JobOp::getAllResIds(uint_set_t& resIds) const
 void
 JobOp::unschedule()
 {
-    _status = opstatus_unstarted;
+    _hot->status = opstatus_unstarted;
     _scheduledBy = sa_undefined;
     _scheduledProcessingTime = uint_t_max;
     _scheduledRemainingPt = uint_t_max;
@@ -407,7 +409,7 @@ bool
 JobOp::isScheduled() const
 {
     // started op must define remaining-pt and resume-time
-    if (_status == opstatus_started)
+    if (_hot->status == opstatus_started)
     {
         if ((_scheduledRemainingPt == 0) || (_scheduledRemainingPt == uint_t_max))
         {
@@ -461,10 +463,10 @@ JobOp::hasRequirements() const
 bool
 JobOp::hasCapacityRequirement() const
 {
-    if (!hasRequirements() || (_processingTime == 0))
+    if (!hasRequirements() || (_hot->processingTime == 0))
         return false;
 
-    if (_processingTime < uint_t_max)
+    if (_hot->processingTime < uint_t_max)
     {
         return true;
     }
@@ -512,19 +514,44 @@ JobOp::isFixed() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+JobOp::setHot(JobOpHot* hot)
+{
+    if (hot == nullptr)
+    {
+        hot = &_ownHot;
+    }
+    if (hot == _hot)
+    {
+        return;
+    }
+    *hot = *_hot;
+    hot->op = this;
+    if (hot == &_ownHot)
+    {
+        hot->jobHot = nullptr;
+    }
+    _hot = hot;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 JobOp::init()
 {
+    _hot = &_ownHot;
+    _hot->op = this;
+    _hot->jobHot = nullptr;
     _id = uint_t_max;
-    _serialId = uint_t_max;
+    _hot->serialId = uint_t_max;
     _sequenceId = uint_t_max;
     _job = nullptr;
     _cost = 0.0;
-    _processingTime = uint_t_max;
+    _hot->processingTime = uint_t_max;
     _type = op_undefined;
-    _status = opstatus_undefined;
+    _hot->status = opstatus_undefined;
     _hasHardCt = false;
-    _frozen = false;
+    _hot->frozen = false;
     _manuallyFrozen = false;
     _scheduledBy = sa_undefined;
     _scheduledProcessingTime = uint_t_max;
@@ -534,8 +561,8 @@ JobOp::init()
     _scheduledResumeTime = -1;
     processUnaryCts();
     _resReqOwner = true;
-    _schedulableOpsIdx = uint_t_max;
-    _act = nullptr;
+    _hot->schedulableOpsIdx = uint_t_max;
+    _hot->act = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -660,8 +687,8 @@ String
 JobOp::toString() const
 {
     MemStream str;
-    str << "op:" << _id << ", type:" << _type << ", status:" << _status
-        << ", frozen:" << Bool(_frozen).toString() << ", st:["
+    str << "op:" << _id << ", type:" << _type << ", status:" << _hot->status
+        << ", frozen:" << Bool(_hot->frozen).toString() << ", st:["
         << Time(_minStartTime).toString("$yy/$m/$d-$h:$nn") << ","
         << Time(_maxStartTime).toString("$yy/$m/$d-$h:$nn") << "], et:["
         << Time(_minEndTime).toString("$yy/$m/$d-$h:$nn") << ","
@@ -20,6 +20,7 @@ CSE_NS_BEGIN;
 class ClevorDataSet;
 class Job;
 class JobOp;
+struct JobHot;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -66,6 +67,30 @@ enum operation_status_t
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+   Frequently accessed state of a JobOp.
+
+   Schedule construction and evaluation read and write these fields for every op on every
+   iteration, so ClevorDataSet stores them together in one contiguous array (see
+   ClevorDataSet::opsHot), apart from the rest of the op's data.  Until the data-set adopts
+   it (during model building), the record is stored in the op itself.
+
+   \ingroup cse
+*/
+struct JobOpHot
+{
+    JobOp* op;                 /**< the op */
+    JobHot* jobHot;            /**< the op's job's record (set by ClevorDataSet) */
+    cls::Activity* act;        /**< activity */
+    uint_t serialId;           /**< serial id */
+    uint_t processingTime;     /**< processing time */
+    uint_t schedulableOpsIdx;  /**< schedulable-ops list index */
+    operation_status_t status; /**< status */
+    bool frozen;               /**< frozen flag */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    Operation belonging to a Job.
 
@@ -104,14 +129,14 @@ public:
     uint_t
     serialId() const
     {
-        return _serialId;
+        return _hot->serialId;
     }
 
     /** Get the serial id. */
     uint_t&
     serialId()
     {
-        return _serialId;
+        return _hot->serialId;
     }
 
     /** Get the sequence id. */
@@ -174,14 +199,14 @@ public:
     uint_t
     processingTime() const
     {
-        return _processingTime;
+        return _hot->processingTime;
     }
 
     /** Get the processing-time. */
     uint_t&
     processingTime()
     {
-        return _processingTime;
+        return _hot->processingTime;
     }
 
     /** Get the type. */
@@ -202,14 +227,14 @@ public:
     operation_status_t
     status() const
     {
-        return _status;
+        return _hot->status;
     }
 
     /** Get the status. */
     operation_status_t&
     status()
     {
-        return _status;
+        return _hot->status;
     }
 
     /** Get has-hard-ct flag. */
@@ -230,14 +255,14 @@ public:
     bool
     frozen() const
     {
-        return _frozen;
+        return _hot->frozen;
     }
 
     /** Get frozen flag. */
     bool&
     frozen()
     {
-        return _frozen;
+        return _hot->frozen;
     }
 
     /** Get manually-frozen flag. */
@@ -440,7 +465,7 @@ public:
     uint_t
     numResGroupReqs() const
     {
-        return _frozen ? 0 : _resGroupReqs.size();
+        return _hot->frozen ? 0 : _resGroupReqs.size();
     }
 
     /** Get a resource group requirement by index. */
@@ -514,40 +539,60 @@ public:
     const clp::CycleGroup*
     esCG() const
     {
-        ASSERTD(_act != nullptr);
-        return _act->esBound().cycleGroup();
+        ASSERTD(_hot->act != nullptr);
+        return _hot->act->esBound().cycleGroup();
     }
 
     /** Get the ES-bound cycle-group. */
     clp::CycleGroup*
     esCG()
     {
-        ASSERTD(_act != nullptr);
-        return _act->esBound().cycleGroup();
+        ASSERTD(_hot->act != nullptr);
+        return _hot->act->esBound().cycleGroup();
     }
 
     /** Get the LF-bound cycle-group. */
     const clp::CycleGroup*
     lfCG() const
     {
-        ASSERTD(_act != nullptr);
-        return _act->lfBound().cycleGroup();
+        ASSERTD(_hot->act != nullptr);
+        return _hot->act->lfBound().cycleGroup();
     }
 
     /** Get the LF-bound cycle-group. */
     clp::CycleGroup*
     lfCG()
     {
-        ASSERTD(_act != nullptr);
-        return _act->lfBound().cycleGroup();
+        ASSERTD(_hot->act != nullptr);
+        return _hot->act->lfBound().cycleGroup();
     }
 
     /** Get schedulable-ops index. */
     uint_t&
     schedulableOpsIdx()
     {
-        return _schedulableOpsIdx;
+        return _hot->schedulableOpsIdx;
     }
+
+    /** Get the hot-state record. */
+    const JobOpHot&
+    hot() const
+    {
+        return *_hot;
+    }
+
+    /** Get the hot-state record. */
+    JobOpHot&
+    hot()
+    {
+        return *_hot;
+    }
+
+    /**
+       Move the hot-state record to the given location (owned by the data-set).
+       \param hot new record (nullptr to move it back into the op)
+    */
+    void setHot(JobOpHot* hot);
     //@}
 
     /// \name Activity
@@ -556,28 +601,28 @@ public:
     bool
     breakable() const
     {
-        return (dynamic_cast<cls::BrkActivity*>(_act) != nullptr);
+        return (dynamic_cast<cls::BrkActivity*>(_hot->act) != nullptr);
     }
 
     /** Interruptible? */
     bool
     interruptible() const
     {
-        return (dynamic_cast<cls::IntActivity*>(_act) != nullptr);
+        return (dynamic_cast<cls::IntActivity*>(_hot->act) != nullptr);
     }
 
     /** Get the activity object. */
     cls::Activity*
     activity() const
     {
-        return _act;
+        return _hot->act;
     }
 
     /** Get the activity object. */
     cls::Activity*&
     activity()
     {
-        return _act;
+        return _hot->act;
     }
 
     /** Get the breakable-activity object. */
@@ -585,7 +630,7 @@ public:
     brkact() const
     {
         ASSERTD(breakable());
-        return (cls::BrkActivity*)_act;
+        return (cls::BrkActivity*)_hot->act;
     }
 
     /** Get the interruptible-activity object. */
@@ -593,7 +638,7 @@ public:
     intact() const
     {
         ASSERTD(interruptible());
-        return (cls::IntActivity*)_act;
+        return (cls::IntActivity*)_hot->act;
     }
     //@}
 
@@ -665,18 +710,14 @@ private:
 
 private:
     uint_t _id;
-    uint_t _serialId;
     uint_t _sequenceId;
     std::string _name;
     Job* _job;
     double _cost;
-    uint_t _processingTime;
 
     operation_t _type;
-    operation_status_t _status;
 
     bool _hasHardCt;
-    bool _frozen;
     bool _manuallyFrozen;
 
     // previous scheduling result
@@ -701,11 +742,10 @@ private:
     cls::resCapPts_set_t _resCapPts;
     mutable cls::resCapPts_set_t _resCapPtsAdj;
 
-    // schedulable-ops list index
-    uint_t _schedulableOpsIdx;
-
-    // activity, start & end times
-    cls::Activity* _act;
+    // hot state: serial id, processing time, status, frozen flag, schedulable-ops list index,
+    // activity (_hot refers to _ownHot, or to our record in ClevorDataSet::opsHot)
+    JobOpHot* _hot;
+    JobOpHot _ownHot;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
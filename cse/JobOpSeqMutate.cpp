@@ -38,6 +38,7 @@ JobOpSeqMutate::copy(const Object& rhs)
     RevOperator::copy(jsmutate);
     _jobs = jsmutate._jobs;
     _ops = jsmutate._ops;
+    _opsHot = jsmutate._opsHot;
     _jobStrPositions = jsmutate._jobStrPositions;
     _jobNumChoices = jsmutate._jobNumChoices;
     _swapOps = jsmutate._swapOps;
@@ -107,8 +108,7 @@ JobOpSeqMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool s
     uint_t i, j;
     for (i = 0; i < totalNumOps; i++)
     {
-        JobOp* op1 = _ops[i];
-        op1->serialId() = string[_stringBase + i];
+        _opsHot[i]->serialId = string.get(_stringBase + i);
     }
 
     // select an op and its job - (jobOpIdx and jobIdx)
@@ -201,7 +201,7 @@ JobOpSeqMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool s
     {
         uint_t idx = *it;
         JobOp* op4 = _ops[initPos + idx];
-        string[_jobStrPositions[jobIdx] + idx] = op4->serialId();
+        string.set(_jobStrPositions[jobIdx] + idx, op4->serialId());
     }
     ASSERTD((op->serialId() - swapOp->serialId() == 1) ||
             (swapOp->serialId() - op->serialId() == 1));
@@ -272,7 +272,7 @@ JobOpSeqMutate::undo()
     {
         uint_t idx = *it;
         JobOp* op = _ops[initPos + idx];
-        string[_jobStrPositions[_moveJobIdx] + idx] = op->serialId();
+        string.set(_jobStrPositions[_moveJobIdx] + idx, op->serialId());
     }
 }
 
@@ -281,7 +281,7 @@ JobOpSeqMutate::undo()
 void
 JobOpSeqMutate::setJobOps(const ClevorDataSet* dataSet)
 {
-    // initialize _jobStrPositions, _jobs and _ops
+    // initialize _jobStrPositions, _jobs, _ops and _opsHot
     auto& jobs = dataSet->jobs();
     uint_t strPosition = _stringBase;
     for (auto job : jobs)
@@ -292,6 +292,7 @@ JobOpSeqMutate::setJobOps(const ClevorDataSet* dataSet)
         for (auto op : jobOps)
         {
             _ops.push_back(op);
+            _opsHot.push_back(&op->hot());
         }
         // note position for this job, and update the position
         _jobStrPositions.push_back(strPosition);
@@ -51,6 +51,7 @@ private:
 
     job_vector_t _jobs;
     jobop_vector_t _ops;
+    std::vector<JobOpHot*> _opsHot; // hot state of _ops[i]
 
     // store each job's string positionnumber of choices, and swap-ops
     uint_vector_t _jobStrPositions; // each job's base index in the string
@@ -68,6 +68,29 @@ JobOpSeqSelector::stringSize(const ClevorDataSet& dataSet) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+JobOpSeqSelector::getSequenceSegments(const gop::DataSet* p_dataSet,
+                                      string_segment_vector_t& segments) const
+{
+    ASSERTD(dynamic_cast<const ClevorDataSet*>(p_dataSet) != nullptr);
+    const ClevorDataSet* dataSet = (const ClevorDataSet*)p_dataSet;
+
+    // op serial-ids are assigned per job, so each job's ops form a separate sequence
+    uint_t begin = _stringBase;
+    for (auto job : dataSet->jobs())
+    {
+        uint_t end = begin + job->allSops().size();
+        if (end > begin)
+        {
+            segments.push_back(string_segment_t(begin, end));
+        }
+        begin = end;
+    }
+    Scheduler::getSequenceSegments(dataSet, segments);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 JobOpSeqSelector::initialize(const gop::DataSet* p_dataSet, uint_t stringBase)
 {
@@ -142,7 +165,7 @@ JobOpSeqSelector::init()
 void
 JobOpSeqSelector::setSelectedJobOpSeq(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     const job_set_id_t& jobs = context->clevorDataSet()->jobs();
     uint_t i = 0;
     job_set_id_t::const_iterator it;
@@ -34,6 +34,7 @@ JobSeqMutate::copy(const Object& rhs)
     const JobSeqMutate& jsmutate = (const JobSeqMutate&)rhs;
     RevOperator::copy(jsmutate);
     _jobs = jsmutate._jobs;
+    _jobsHot = jsmutate._jobsHot;
     _swapJobs = jsmutate._swapJobs;
 
     _moveSchedule = jsmutate._moveSchedule;
@@ -90,8 +91,7 @@ JobSeqMutate::execute(gop::Ind* ind, gop::IndBuilderContext* context, bool singl
     uint_t i;
     for (i = 0; i < numJobs; i++)
     {
-        Job* job1 = _jobs[i];
-        job1->serialId() = string[_stringBase + i];
+        _jobsHot[i]->serialId = string.get(_stringBase + i);
     }
 
     //select a job - (jobIdx)
@@ -171,7 +171,7 @@ JobSeqMutate::execute(gop::Ind* ind, gop::IndBuilderContext* context, bool singl
     {
         uint_t idx = *it;
         Job* job1 = _jobs[idx];
-        string[_stringBase + idx] = job1->serialId();
+        string.set(_stringBase + idx, job1->serialId());
     }
     //disable the following two lines because job can equal to swapJob
 //     ASSERTD((job->serialId() - swapJob->serialId() == 1) ||
@@ -207,6 +207,7 @@ JobSeqMutate::setJobs(const ClevorDataSet* dataSet)
         Job* job = *jobIt;
         CycleGroup* cg = job->cycleGroup();
         _jobs.push_back(job);
+        _jobsHot.push_back(&job->hot());
         const cg_revset_t& allPredCGs = cg->allPredCGs();
         const cg_revset_t& allSuccCGs = cg->allSuccCGs();
         cg_set_id_t tempCandidates, cgCandidates;
@@ -314,7 +315,7 @@ JobSeqMutate::undo()
     {
         uint_t idx = *it;
         Job* job = _jobs[idx];
-        string[_stringBase + idx] = job->serialId();
+        string.set(_stringBase + idx, job->serialId());
     }
 }
 
@@ -57,6 +57,7 @@ private:
     void setJobs(const ClevorDataSet* dataSet);
 
     job_vector_t _jobs;
+    std::vector<JobHot*> _jobsHot; // hot state of _jobs[i]
     job_vector_vector_t _swapJobs;
 
     gop::StringInd<uint_t>* _moveSchedule;
@@ -69,6 +69,19 @@ JobSeqSelector::stringSize(const ClevorDataSet& dataSet) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+JobSeqSelector::getSequenceSegments(const gop::DataSet* p_dataSet,
+                                    string_segment_vector_t& segments) const
+{
+    ASSERTD(dynamic_cast<const ClevorDataSet*>(p_dataSet) != nullptr);
+    const ClevorDataSet* dataSet = (const ClevorDataSet*)p_dataSet;
+    uint_t numJobs = dataSet->jobs().size();
+    segments.push_back(string_segment_t(_stringBase, _stringBase + numJobs));
+    Scheduler::getSequenceSegments(dataSet, segments);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 JobSeqSelector::initialize(const gop::DataSet* p_dataSet, uint_t stringBase)
 {
@@ -130,7 +143,7 @@ JobSeqSelector::init()
 void
 JobSeqSelector::setSelectedJobSeq(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     const job_set_id_t& jobs = context->clevorDataSet()->jobs();
     uint_t i = 0;
     job_set_id_t::const_iterator it;
@@ -0,0 +1,388 @@
+#include "libcse.h"
+#include <clp/FailEx.h>
+#include <clp/Or.h>
+#include <gop/ConfigEx.h>
+#include "LNSoptimizer.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef DEBUG
+#define DEBUG_UNIT
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+GOP_NS_USE;
+CLP_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   LNSoptimizer's search goal.
+
+   - branch on the item for the given rank (if item = uint_t_max)
+   - assign the given rank's serial-id to the given item (otherwise)
+*/
+class LNSgoal : public Goal
+{
+    UTL_CLASS_DECL(LNSgoal, Goal);
+
+public:
+    LNSgoal(LNSoptimizer* lns, uint_t rank, uint_t item = uint_t_max)
+        : Goal(lns->_mgr)
+    {
+        _lns = lns;
+        _rank = rank;
+        _item = item;
+    }
+
+    virtual void
+    execute()
+    {
+        if (_item == uint_t_max)
+        {
+            _lns->branch(_rank);
+        }
+        else
+        {
+            _lns->assign(_rank, _item);
+        }
+    }
+
+private:
+    void
+    init()
+    {
+        _lns = nullptr;
+        _rank = uint_t_max;
+        _item = uint_t_max;
+    }
+    void
+    deInit()
+    {
+    }
+
+private:
+    LNSoptimizer* _lns;
+    uint_t _rank;
+    uint_t _item;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_END;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(cse::LNSgoal);
+UTL_CLASS_IMPL(cse::LNSoptimizer);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::copy(const Object& rhs)
+{
+    auto& lns = utl::cast<LNSoptimizer>(rhs);
+    super::copy(lns);
+    _windowSize = lns._windowSize;
+    _failLimit = lns._failLimit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::serialize(Stream& stream, uint_t io, uint_t)
+{
+    utl::serialize(_windowSize, stream, io);
+    utl::serialize(_failLimit, stream, io);
+    if ((io == io_rd) && ((_windowSize < 2) || (_failLimit == 0)))
+    {
+        throw ConfigEx();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::initialize(const OptimizerConfiguration* config)
+{
+    Optimizer::initialize(config);
+
+    // initialize _ind
+    ASSERTD(_ind != nullptr);
+    _indBuilder->initializeInd(_ind, config->dataSet(), _rng);
+    _singleStep = false;
+
+    // construct our initial individual and set initial & best scores
+    iterationRun();
+    setInitScore(utl::clone(_newScore));
+    setBestScore(utl::clone(_newScore));
+    if (_ind->newString())
+        _ind->acceptNewString();
+    auto objective = _objectives[0];
+    objective->setBestScore(utl::clone(_bestScore));
+    _bestString = utl::clone(_ind->stringPtr());
+
+#ifdef DEBUG_UNIT
+    utl::cout << initString(!_fail) << utl::endlf;
+#endif
+
+    // find the sequence segments that have at least two sequenced items
+    string_segment_vector_t segments;
+    _indBuilder->getSequenceSegments(config->dataSet(), segments);
+    auto& str = *_bestString;
+    for (auto& segment : segments)
+    {
+        uint_t numItems = 0;
+        for (uint_t pos = segment.first; pos != segment.second; ++pos)
+        {
+            if (str[pos] != uint_t_max)
+            {
+                ++numItems;
+            }
+        }
+        if (numItems >= 2)
+        {
+            _seqSegments.push_back(segment);
+        }
+    }
+
+    _mgr = new Manager();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+LNSoptimizer::run()
+{
+    ASSERTD(!complete());
+    ASSERTD(_ind != nullptr);
+
+    // nothing to re-sequence?
+    if (_seqSegments.empty())
+    {
+        _iteration = _maxIterations;
+    }
+
+    bool complete = this->complete();
+    while (!complete)
+    {
+        // relax a window, and search for a better order
+        if (chooseWindow())
+        {
+            searchWindow();
+        }
+        complete = this->complete();
+        if (!complete)
+        {
+            updateRunStatus(complete);
+        }
+    }
+    ASSERT(this->complete());
+
+    // re-generate the best schedule and get audit text
+    _ind->setString(_bestString, false);
+    bool scheduleFeasible = iterationRun(nullptr, true);
+#ifdef DEBUG
+    if (scheduleFeasible)
+        ASSERTD(*_bestScore == *_newScore);
+#endif
+    utl::cout << finalString(scheduleFeasible) << utl::endlf;
+    updateRunStatus(true);
+    return scheduleFeasible;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::audit()
+{
+    ASSERTD(_bestString != nullptr);
+    _ind->setString(_bestString, false);
+    if (!iterationRun(nullptr, true))
+        ABORT();
+    ASSERTD(*_bestScore == *_newScore);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::init()
+{
+    _windowSize = 5;
+    _failLimit = 100;
+    _bestString = nullptr;
+    _mgr = nullptr;
+    _numFails = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::deInit()
+{
+    // _ind may refer to _bestString
+    if (_ind != nullptr)
+    {
+        _ind->setString(nullptr);
+    }
+    delete _bestString;
+    delete _mgr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+LNSoptimizer::chooseWindow()
+{
+    // choose a sequence segment, and order its sequenced items by serial-id
+    auto& segment = _seqSegments[_rng->uniform((size_t)0, _seqSegments.size() - 1)];
+    const String<uint_t>& str = _ind->string();
+    _segmentItems.clear();
+    for (uint_t pos = segment.first; pos != segment.second; ++pos)
+    {
+        uint_t sid = str[pos];
+        if (sid != uint_t_max)
+        {
+            _segmentItems.push_back(std::make_pair(sid, pos));
+        }
+    }
+    uint_t numSegmentItems = _segmentItems.size();
+    if (numSegmentItems < 2)
+    {
+        return false;
+    }
+    std::sort(_segmentItems.begin(), _segmentItems.end());
+
+    // the window is a run of consecutive serial-ids (item i initially has rank i)
+    uint_t numItems = utl::min(_windowSize, numSegmentItems);
+    uint_t begin = _rng->uniform((uint_t)0, numSegmentItems - numItems);
+    _values.clear();
+    _positions.clear();
+    for (uint_t i = begin; i != begin + numItems; ++i)
+    {
+        _values.push_back(_segmentItems[i].first);
+        _positions.push_back(_segmentItems[i].second);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+LNSoptimizer::searchWindow()
+{
+    _numFails = 0;
+    _itemRanks.assign(_positions.size(), uint_t_max);
+
+    // each solution is an improving leaf (recorded in _bestString)
+    bool improved = false;
+    _mgr->add(new LNSgoal(this, 0));
+    while (_mgr->nextSolution())
+    {
+        improved = true;
+    }
+
+    // the search leaves its last leaf in _ind -> continue from the best string
+    _ind->string().copy(*_bestString);
+    return improved;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::branch(uint_t rank)
+{
+    if ((_numFails >= _failLimit) || complete())
+    {
+        throw FailEx();
+    }
+
+    // all ranks are assigned -> construct and evaluate the schedule
+    uint_t numItems = _positions.size();
+    if (rank == numItems)
+    {
+        evaluateLeaf();
+        return;
+    }
+
+    // one choice per unassigned item (the item that currently has this rank is tried first)
+    uint_vector_t items;
+    if (_itemRanks[rank] == uint_t_max)
+    {
+        items.push_back(rank);
+    }
+    for (uint_t item = 0; item != numItems; ++item)
+    {
+        if ((item != rank) && (_itemRanks[item] == uint_t_max))
+        {
+            items.push_back(item);
+        }
+    }
+    ASSERTD(!items.empty());
+    Goal* goal = new LNSgoal(this, rank, items.back());
+    for (uint_t i = items.size() - 1; i-- != 0;)
+    {
+        goal = new Or(new LNSgoal(this, rank, items[i]), goal);
+    }
+    _mgr->add(goal);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::assign(uint_t rank, uint_t item)
+{
+    if (_numFails >= _failLimit)
+    {
+        throw FailEx();
+    }
+    _mgr->revSet(_itemRanks[item], rank);
+    _ind->string().set(_positions[item], _values[rank]);
+    _mgr->add(new LNSgoal(this, rank + 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+LNSoptimizer::evaluateLeaf()
+{
+    _iteration++;
+    iterationRun();
+    auto objective = _objectives[0];
+    int cmpResult = objective->compare(_newScore, _bestScore);
+    _sameScore = (cmpResult == 0);
+    _newBest = (cmpResult > 0);
+    _accept = _newBest;
+#ifdef DEBUG_UNIT
+    utl::cout << iterationString() << utl::endl;
+#endif
+
+    // not an improvement -> fail (and backtrack to the next choice)
+    if (!_newBest)
+    {
+        ++_numFails;
+        throw FailEx();
+    }
+
+    // improvement -> tighten the bound (the search continues for a better one)
+    _improvementIteration = _iteration;
+    copyBestScore(_newScore);
+    _bestString->copy(_ind->string());
+    objective->copyBestScore(_bestScore);
+    updateRunStatus(false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_END;
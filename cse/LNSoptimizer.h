@@ -0,0 +1,118 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <clp/Manager.h>
+#include <gop/Optimizer.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Large-neighborhood search.
+
+   Each step relaxes a window of the current sequence and freezes the rest:
+
+   - a sequence segment is chosen at random (see gop::IndBuilder::getSequenceSegments)
+   - the window is a run of consecutive serial-ids in that segment (a stretch of the schedule's
+     order, e.g. the ops that are scheduled around the same time, or all of a job's ops if the
+     job is small enough)
+
+   A bounded branch-and-bound search then tries other orders for the window's items: a
+   clp::Manager drives the search with goals that assign the window's serial-ids to its items
+   (one clp::Or choice point per serial-id).  At each leaf, the schedule is constructed and
+   evaluated, and leaves that don't improve on the best score fail (backtracking to the next
+   choice).  An improving leaf tightens the bound, and the search continues.  The search ends
+   when it is exhausted, or when the fail limit is reached.
+
+   Improvements are accepted, and the search moves on to another window.  Each constructed
+   schedule counts as one iteration.
+
+   The window size (default 5) and the fail limit (default 100) are serialized with the
+   optimizer, so a client sets them on the LNSoptimizer that it sends to the server.
+
+   \ingroup cse
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class LNSoptimizer : public gop::Optimizer
+{
+    UTL_CLASS_DECL(LNSoptimizer, gop::Optimizer);
+    friend class LNSgoal;
+
+public:
+    virtual void copy(const utl::Object& rhs);
+
+    virtual void serialize(utl::Stream& stream, uint_t io, uint_t mode = utl::ser_default);
+
+    /** Initialize. */
+    virtual void initialize(const gop::OptimizerConfiguration* config);
+
+    /** Run the search. */
+    virtual bool run();
+
+    /** Audit the result. */
+    virtual void audit();
+
+    /** Get the maximum number of items in a window. */
+    uint_t
+    windowSize() const
+    {
+        return _windowSize;
+    }
+
+    /** Set the maximum number of items in a window (at least 2). */
+    void
+    setWindowSize(uint_t windowSize)
+    {
+        _windowSize = utl::max(windowSize, (uint_t)2);
+    }
+
+    /** Get the maximum number of failures in each window's search. */
+    uint_t
+    failLimit() const
+    {
+        return _failLimit;
+    }
+
+    /** Set the maximum number of failures in each window's search (at least 1). */
+    void
+    setFailLimit(uint_t failLimit)
+    {
+        _failLimit = utl::max(failLimit, (uint_t)1);
+    }
+
+private:
+    void init();
+    void deInit();
+
+    bool chooseWindow();
+    bool searchWindow();
+
+    // search goals
+    void branch(uint_t rank);
+    void assign(uint_t rank, uint_t item);
+    void evaluateLeaf();
+
+private:
+    uint_t _windowSize;
+    uint_t _failLimit;
+    gop::string_segment_vector_t _seqSegments;
+    gop::String<uint_t>* _bestString;
+
+    // search
+    clp::Manager* _mgr;
+    uint_t _numFails;
+    uint_vector_t _positions; // string position of each item
+    uint_vector_t _values;    // serial-id for each rank
+    uint_vector_t _itemRanks; // rank assigned to each item (uint_t_max if unassigned)
+    std::vector<std::pair<uint_t, uint_t>> _segmentItems;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_END;
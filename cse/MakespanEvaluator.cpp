@@ -27,4 +27,18 @@ MakespanEvaluator::calcScore(const IndBuilderContext* p_context) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+double
+MakespanEvaluator::scoreLowerBound(const IndBuilderContext* p_context) const
+{
+    if (!_schedulerConfig->forward())
+    {
+        return -utl::double_t_max;
+    }
+    ASSERTD(dynamic_cast<const SchedulingContext*>(p_context) != nullptr);
+    const SchedulingContext* context = (const SchedulingContext*)p_context;
+    return context->makespanLowerBound();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 CSE_NS_END;
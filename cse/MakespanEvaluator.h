@@ -32,6 +32,9 @@ public:
     }
 
     virtual double calcScore(const gop::IndBuilderContext* context) const;
+
+    /** Get a lower bound on the makespan of a partial (forward) schedule. */
+    virtual double scoreLowerBound(const gop::IndBuilderContext* context) const;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@ OpSeqMutate::copy(const Object& rhs)
     const OpSeqMutate& jsmutate = (const OpSeqMutate&)rhs;
     RevOperator::copy(jsmutate);
     _ops = jsmutate._ops;
+    _opsHot = jsmutate._opsHot;
     _swapOpsMap = jsmutate._swapOpsMap;
 
     _moveSchedule = jsmutate._moveSchedule;
@@ -97,8 +98,7 @@ OpSeqMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool sing
     uint_t i;
     for (i = 0; i < numOps; i++)
     {
-        JobOp* op1 = _ops[i];
-        op1->serialId() = string[_stringBase + i];
+        _opsHot[i]->serialId = string.get(_stringBase + i);
     }
 
     //select an op
@@ -169,7 +169,7 @@ OpSeqMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool sing
     {
         uint_t idx = *it;
         JobOp* op1 = _ops[idx];
-        string[_stringBase + idx] = op1->serialId();
+        string.set(_stringBase + idx, op1->serialId());
     }
     ASSERTD(op->breakable() || op->interruptible());
     ASSERTD(swapOp->breakable() || swapOp->interruptible());
@@ -233,7 +233,7 @@ OpSeqMutate::undo()
     {
         uint_t idx = *it;
         JobOp* op = _ops[idx];
-        string[_stringBase + idx] = op->serialId();
+        string.set(_stringBase + idx, op->serialId());
     }
 }
 
@@ -244,6 +244,7 @@ OpSeqMutate::setOps(const ClevorDataSet* dataSet)
 {
     //initialize _ops and _swapOpsMap
     _ops.clear();
+    _opsHot.clear();
     deleteMapSecond(_swapOpsMap);
     const jobop_set_id_t& ops = dataSet->sops();
     jobop_set_id_t::const_iterator opIt;
@@ -251,6 +252,7 @@ OpSeqMutate::setOps(const ClevorDataSet* dataSet)
     {
         JobOp* op = *opIt;
         _ops.push_back(op);
+        _opsHot.push_back(&op->hot());
         jobop_vector_t* opVect = new jobop_vector_t();
         _swapOpsMap.insert(jobop_jobopvector_map_t::value_type(op, opVect));
     }
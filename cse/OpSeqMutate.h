@@ -58,7 +58,8 @@ private:
 private:
     void setOps(const ClevorDataSet* dataSet);
 
-    jobop_vector_t _ops; //for indexing ops
+    jobop_vector_t _ops;            //for indexing ops
+    std::vector<JobOpHot*> _opsHot; // hot state of _ops[i]
     jobop_jobopvector_map_t _swapOpsMap;
 
     gop::StringInd<uint_t>* _moveSchedule;
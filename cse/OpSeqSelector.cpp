@@ -68,6 +68,19 @@ OpSeqSelector::stringSize(const ClevorDataSet& dataSet) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+OpSeqSelector::getSequenceSegments(const gop::DataSet* p_dataSet,
+                                   string_segment_vector_t& segments) const
+{
+    ASSERTD(dynamic_cast<const ClevorDataSet*>(p_dataSet) != nullptr);
+    const ClevorDataSet* dataSet = (const ClevorDataSet*)p_dataSet;
+    uint_t numOps = dataSet->sops().size();
+    segments.push_back(string_segment_t(_stringBase, _stringBase + numOps));
+    Scheduler::getSequenceSegments(dataSet, segments);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 OpSeqSelector::initialize(const gop::DataSet* p_dataSet, uint_t stringBase)
 {
@@ -140,7 +153,7 @@ OpSeqSelector::init()
 void
 OpSeqSelector::setSelectedOpSeq(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     const jobop_set_id_t& ops = context->clevorDataSet()->sops();
     uint_t i = 0;
     jobop_set_id_t::const_iterator it;
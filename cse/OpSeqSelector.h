@@ -23,6 +23,9 @@ public:
 
     virtual uint_t stringSize(const ClevorDataSet& dataSet) const;
 
+    virtual void getSequenceSegments(const gop::DataSet* dataSet,
+                                     gop::string_segment_vector_t& segments) const;
+
     virtual void initialize(const gop::DataSet* dataSet = nullptr, uint_t stringBase = 0);
 
     virtual void initializeInd(gop::Ind* ind,
@@ -6,6 +6,10 @@
 #include <gop/AR_SAoptimizer.h>
 #include <gop/MultistartHC.h>
 #include <gop/MultistartSA.h>
+#include <gop/GAoptimizer.h>
+#include <gop/ParetoSA.h>
+#include <gop/TabuSearch.h>
+#include <cse/LNSoptimizer.h>
 #include "OptimizerFactory.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +61,22 @@ OptimizerFactory::make(void* param, void*) const
     {
         optimizer = new MultistartSA();
     }
+    else if (name == "GAoptimizer")
+    {
+        optimizer = new GAoptimizer();
+    }
+    else if (name == "ParetoSA")
+    {
+        optimizer = new ParetoSA();
+    }
+    else if (name == "TabuSearch")
+    {
+        optimizer = new TabuSearch();
+    }
+    else if (name == "LNSoptimizer")
+    {
+        optimizer = new LNSoptimizer();
+    }
     return optimizer;
 }
 
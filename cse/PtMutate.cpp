@@ -85,7 +85,7 @@ PtMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool singleS
               << "varSucRate:" << this->varP() << ", idx:" << actIdx;
 #endif
     _movePtIdx = _stringBase + actIdx;
-    _movePt = string[_movePtIdx];
+    _movePt = string.get(_movePtIdx);
     PtActivity* act = _acts[actIdx];
 
     // choose processing-time
@@ -133,7 +133,7 @@ PtMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, bool singleS
         if (pt >= _movePt)
             pt = (*pts)[++ptIdx];
     }
-    string[_movePtIdx] = pt;
+    string.set(_movePtIdx, pt);
 
     ASSERTD(pt != _movePt);
 #ifdef DEBUG_UNIT
@@ -168,7 +168,7 @@ PtMutate::undo()
     if (_movePtIdx != uint_t_max)
     {
         ASSERTD(_movePt != uint_t_max);
-        string[_movePtIdx] = _movePt;
+        string.set(_movePtIdx, _movePt);
     }
 }
 
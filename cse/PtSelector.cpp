@@ -167,7 +167,7 @@ void
 PtSelector::setPts(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
     ASSERTD(_config != nullptr);
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     Manager* mgr = context->manager();
     uint_t numActs = _acts.size();
     for (uint_t i = 0; i < numActs; ++i)
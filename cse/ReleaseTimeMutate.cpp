@@ -89,12 +89,12 @@ ReleaseTimeMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, boo
               << "varSucRate:" << this->varP() << ", idx:" << actIdx;
 #endif
     _moveActIdx = _stringBase + actIdx;
-    _moveActRlsTime = string[_moveActIdx];
+    _moveActRlsTime = string.get(_moveActIdx);
     Activity* act = _acts[actIdx];
 
     // change the activity's release time
     uint_t newRlsTime;
-    uint_t oldRlsTime = string[_moveActIdx];
+    uint_t oldRlsTime = string.get(_moveActIdx);
     if (oldRlsTime - _changeStep < _minRlsTimes[actIdx])
     {
         newRlsTime = oldRlsTime + _changeStep;
@@ -111,7 +111,7 @@ ReleaseTimeMutate::execute(gop::Ind* ind, gop::IndBuilderContext* p_context, boo
             newRlsTime = oldRlsTime - _changeStep;
         }
     }
-    string[_moveActIdx] = newRlsTime;
+    string.set(_moveActIdx, newRlsTime);
 
 #ifdef DEBUG_UNIT
     time_t minT, oldT, newT, existingT;
@@ -156,7 +156,7 @@ ReleaseTimeMutate::undo()
     if (_moveSchedule->newString())
         _moveSchedule->deleteNewString();
     gop::String<uint_t>& string = _moveSchedule->string();
-    string[_moveActIdx] = _moveActRlsTime;
+    string.set(_moveActIdx, _moveActRlsTime);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -189,7 +189,7 @@ ReleaseTimeSelector::setReleaseTimes(StringInd<uint_t>* ind, SchedulingContext*
     utl::cout << "In ReleaseTimeSelector::setReleaseTime() ..." << utl::endlf;
 #endif
     ASSERTD(_config != nullptr);
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     uint_t numActs = _acts.size();
     for (uint_t i = 0; i < numActs; ++i)
     {
@@ -90,12 +90,12 @@ ResCapMutate::execute(gop::Ind* p_ind, gop::IndBuilderContext* p_context, bool s
     // select a resource (resIdx)
     uint_t resIdx = this->varIdx();
     _moveResIdx = resIdx;
-    _moveResCap = string[_stringBase + _moveResIdx];
+    _moveResCap = string.get(_stringBase + _moveResIdx);
     cse::DiscreteResource* res = _resources[resIdx];
 
     // choose resource capacity
     uint_t step = res->stepCap();
-    uint_t oldCap = string[_stringBase + _moveResIdx];
+    uint_t oldCap = string.get(_stringBase + _moveResIdx);
     uint_t cap;
     if (singleStep)
     {
@@ -129,7 +129,7 @@ ResCapMutate::execute(gop::Ind* p_ind, gop::IndBuilderContext* p_context, bool s
         if (cap >= oldCap)
             cap = utl::min(cap + step, _maxCaps[resIdx]);
     }
-    string[_stringBase + _moveResIdx] = cap;
+    string.set(_stringBase + _moveResIdx, cap);
 #ifdef DEBUG_UNIT
     utl::cout << "                                                   "
               << " res:" << res->id() << ", size:" << _maxCaps[resIdx] - _minCaps[resIdx]
@@ -164,7 +164,7 @@ ResCapMutate::undo()
     if (_moveSchedule->newString())
         _moveSchedule->deleteNewString();
     gop::String<uint_t>& string = _moveSchedule->string();
-    string[_stringBase + _moveResIdx] = _moveResCap;
+    string.set(_stringBase + _moveResIdx, _moveResCap);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,7 +168,7 @@ void
 ResCapSelector::setSelectedResCaps(StringInd<uint_t>* ind, SchedulingContext* context) const
 {
     ASSERTD(_config != nullptr);
-    gop::String<uint_t>& string = ind->string();
+    const gop::String<uint_t>& string = ind->string();
     Manager* mgr = context->manager();
     uint_t numResources = _resources.size();
     for (uint_t i = 0; i < numResources; ++i)
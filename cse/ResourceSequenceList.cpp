@@ -15,6 +15,11 @@ UTL_CLASS_IMPL(cse::ResourceSequenceList);
 
 CSE_NS_BEGIN;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// maximum number of entries in a ResourceSequenceList's rule matrix
+static const uint64_t maxMatrixSize = 16 * 1024 * 1024;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // ResourceSequenceRule ////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,6 +91,7 @@ ResourceSequenceList::copy(const Object& rhs)
     const ResourceSequenceList& rsl = (const ResourceSequenceList&)rhs;
     _id = rsl._id;
     copySet(_rsl, rsl._rsl);
+    _compiled = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,12 +126,115 @@ ResourceSequenceList::serialize(Stream& stream, uint_t io, uint_t)
 {
     utl::serialize(_id, stream, io);
     lut::serialize(_rsl, stream, io);
+    if (io == io_rd)
+    {
+        _compiled = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ResourceSequenceList::add(uint_t lhsOpSequenceId, uint_t rhsOpSequenceId, uint_t delay, double cost)
+{
+    ResourceSequenceRule* rsr =
+        new ResourceSequenceRule(lhsOpSequenceId, rhsOpSequenceId, delay, cost);
+    _rsl.insert(rsr);
+    _compiled = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ResourceSequenceList::compile()
+{
+    // _rules, _seqIds
+    _rules.clear();
+    _seqIds.clear();
+    for (auto rsr : _rsl)
+    {
+        _rules.push_back(rsr);
+        if (rsr->lhsOpSequenceId() != uint_t_max)
+        {
+            _seqIds.push_back(rsr->lhsOpSequenceId());
+        }
+        if (rsr->rhsOpSequenceId() != uint_t_max)
+        {
+            _seqIds.push_back(rsr->rhsOpSequenceId());
+        }
+    }
+    std::sort(_seqIds.begin(), _seqIds.end());
+    _seqIds.erase(std::unique(_seqIds.begin(), _seqIds.end()), _seqIds.end());
+    uint_t numSeqIds = _seqIds.size();
+    _matrixDim = numSeqIds + 2;
+
+    // too many op-sequence-ids for a dense matrix -> findRule() scans the rules
+    _compiled = false;
+    if (((uint64_t)_matrixDim * (uint64_t)_matrixDim) > maxMatrixSize)
+    {
+        _matrix.clear();
+        return;
+    }
+
+    // small op-sequence-ids -> index them with a table instead of a binary search
+    _seqIdxTable.clear();
+    uint_t maxSeqId = (numSeqIds == 0) ? 0 : _seqIds.back();
+    if (maxSeqId < utl::max((uint_t)1024, 16 * numSeqIds))
+    {
+        _seqIdxTable.resize(maxSeqId + 1, numSeqIds);
+        for (uint_t i = 0; i != numSeqIds; ++i)
+        {
+            _seqIdxTable[_seqIds[i]] = i;
+        }
+    }
+
+    // fill in the matching rule for each (lhs,rhs) pair
+    // (rules are applied last-to-first, so the first matching rule is the one that remains)
+    _matrix.assign(_matrixDim * _matrixDim, uint_t_max);
+    uint_vector_t lhsIdxs, rhsIdxs;
+    for (uint_t ruleIdx = _rules.size(); ruleIdx-- != 0;)
+    {
+        auto rsr = _rules[ruleIdx];
+        getMatchingIdxs(rsr->lhsOpSequenceId(), lhsIdxs);
+        getMatchingIdxs(rsr->rhsOpSequenceId(), rhsIdxs);
+        for (auto lhsIdx : lhsIdxs)
+        {
+            uint_t* row = &_matrix[lhsIdx * _matrixDim];
+            for (auto rhsIdx : rhsIdxs)
+            {
+                row[rhsIdx] = ruleIdx;
+            }
+        }
+    }
+    _compiled = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ResourceSequenceList::getMatchingIdxs(uint_t rsrosid, uint_vector_t& idxs) const
+{
+    // a wildcard matches every index, and an op-sequence-id matches its own index and the
+    // index for uint_t_max (which matches every rule)
+    idxs.clear();
+    if (rsrosid == uint_t_max)
+    {
+        for (uint_t idx = 0; idx != _matrixDim; ++idx)
+        {
+            idxs.push_back(idx);
+        }
+    }
+    else
+    {
+        idxs.push_back(sequenceIdx(rsrosid));
+        idxs.push_back(_matrixDim - 1);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 const ResourceSequenceRule*
-ResourceSequenceList::findRule(uint_t lhsosid, uint_t rhsosid) const
+ResourceSequenceList::scanRules(uint_t lhsosid, uint_t rhsosid) const
 {
     rsr_set_t::const_iterator it;
     for (it = _rsl.begin(); it != _rsl.end(); ++it)
@@ -154,20 +263,12 @@ ResourceSequenceList::findRule(uint_t lhsosid, uint_t rhsosid) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void
-ResourceSequenceList::add(uint_t lhsOpSequenceId, uint_t rhsOpSequenceId, uint_t delay, double cost)
-{
-    ResourceSequenceRule* rsr =
-        new ResourceSequenceRule(lhsOpSequenceId, rhsOpSequenceId, delay, cost);
-    _rsl.insert(rsr);
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////
-
 void
 ResourceSequenceList::init()
 {
     _id = uint_t_max;
+    _compiled = false;
+    _matrixDim = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,6 +95,17 @@ typedef std::set<ResourceSequenceRule*, lut::ObjectOrdering> rsr_set_t;
 /**
    Delays/costs that depend on sequence of operations scheduled on a resource.
 
+   A rule's op-sequence-id may be uint_t_max (a wildcard that matches any op-sequence-id), and
+   findRule() returns the first matching rule.  Scanning the rules for every pair of adjacent
+   activities is costly when there are many op-sequence-ids, so compile() resolves the
+   matching rule for every (lhs,rhs) pair in advance:
+
+   - each op-sequence-id that appears in a rule gets a dense index, and two more indexes stand
+     for "any other op-sequence-id" and uint_t_max
+   - the matrix entry for (lhs-index,rhs-index) is the index of the matching rule
+
+   After compile(), findRule() is two index lookups and one matrix lookup.
+
    \ingroup cse
 */
 
@@ -133,11 +144,31 @@ public:
     }
 
     /** Find the first record to match the give op-sequence-ids. */
-    const ResourceSequenceRule* findRule(uint_t lhsOpSequenceId, uint_t rhsOpSequenceId) const;
+    const ResourceSequenceRule*
+    findRule(uint_t lhsOpSequenceId, uint_t rhsOpSequenceId) const
+    {
+        if (!_compiled)
+        {
+            return scanRules(lhsOpSequenceId, rhsOpSequenceId);
+        }
+        uint_t idx = _matrix[(sequenceIdx(lhsOpSequenceId) * _matrixDim) +
+                             sequenceIdx(rhsOpSequenceId)];
+        return (idx == uint_t_max) ? nullptr : _rules[idx];
+    }
 
     /** Add a delay/cost for the given sequencing. */
     void add(uint_t lhsOpSequenceId, uint_t rhsOpSequenceId, uint_t delay, double cost);
 
+    /** Build the rule matrix (see findRule). */
+    void compile();
+
+    /** Compiled? */
+    bool
+    compiled() const
+    {
+        return _compiled;
+    }
+
     /** Get begin iterator. */
     iterator
     begin() const
@@ -156,8 +187,36 @@ private:
     void init();
     void deInit();
 
+    const ResourceSequenceRule* scanRules(uint_t lhsosid, uint_t rhsosid) const;
+
+    void getMatchingIdxs(uint_t rsrosid, uint_vector_t& idxs) const;
+
+    uint_t
+    sequenceIdx(uint_t osid) const
+    {
+        if (osid == uint_t_max)
+        {
+            return _matrixDim - 1;
+        }
+        if (!_seqIdxTable.empty())
+        {
+            return (osid < _seqIdxTable.size()) ? _seqIdxTable[osid] : (_matrixDim - 2);
+        }
+        auto it = std::lower_bound(_seqIds.begin(), _seqIds.end(), osid);
+        return ((it == _seqIds.end()) || (*it != osid)) ? (_matrixDim - 2)
+                                                        : (it - _seqIds.begin());
+    }
+
     uint_t _id;
     rsr_set_t _rsl;
+
+    // compiled rules
+    bool _compiled;
+    std::vector<const ResourceSequenceRule*> _rules; // rules in _rsl order
+    uint_vector_t _seqIds;                           // op-sequence-ids in rules (sorted)
+    uint_vector_t _seqIdxTable;                      // op-sequence-id -> index (if dense)
+    uint_t _matrixDim;                               // _seqIds.size() + 2
+    uint_vector_t _matrix;                           // (lhs,rhs) index -> rule index
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
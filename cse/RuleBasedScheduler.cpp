@@ -455,20 +455,20 @@ OpSequenceScheduler::initRun(SchedulingContext* context) const
     // init _idx
     _idx = 0;
 
-    // init _ops
+    // init _ops (from the ops' hot state, without touching the JobOp objects)
     _ops.clear();
     ClevorDataSet* dataSet = (ClevorDataSet*)context->dataSet();
-    const jobop_set_id_t& ops = dataSet->sops();
-    jobop_set_id_t::const_iterator opIt;
-    for (opIt = ops.begin(); opIt != ops.end(); ++opIt)
+    for (auto opHot : dataSet->sopsHot())
     {
-        JobOp* op = *opIt;
-        if (op->frozen() || !op->job()->active())
+        if (opHot->frozen || !opHot->jobHot->active)
             continue;
-        _ops += op;
+        _ops.push_back(opHot);
     }
-    // sort _ops by SID
-    _ops.setOrdering(*_opOrdering);
+    // sort _ops by SID (ties are broken by the op's position in the hot view)
+    std::sort(_ops.begin(), _ops.end(), [](const JobOpHot* lhs, const JobOpHot* rhs) {
+        return (lhs->serialId < rhs->serialId) ||
+               ((lhs->serialId == rhs->serialId) && (lhs < rhs));
+    });
 
     // release all jobs
     const job_set_id_t& jobs = dataSet->jobs();
@@ -488,19 +488,17 @@ OpSequenceScheduler::initRun(SchedulingContext* context) const
 JobOp*
 OpSequenceScheduler::selectOp(SchedulingContext* context) const
 {
-    ASSERTD(_idx <= _ops.items());
+    ASSERTD(_idx <= _ops.size());
 
     // all done?
-    if (_idx == _ops.items())
+    if (_idx == _ops.size())
     {
         context->setComplete(true);
         //         _terminate = true;
         return nullptr;
     }
 
-    ASSERTD(_ops[_idx]->isA(JobOp));
-    JobOp* op = (JobOp*)_ops[_idx++];
-    return op;
+    return _ops[_idx++]->op;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,7 +506,6 @@ OpSequenceScheduler::selectOp(SchedulingContext* context) const
 void
 OpSequenceScheduler::init()
 {
-    _ops.setOwner(false);
     setOpOrdering(new OpOrderingIncSID());
 }
 
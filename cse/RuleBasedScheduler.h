@@ -166,7 +166,7 @@ private:
 
 private:
     mutable uint_t _idx;
-    mutable utl::Array _ops;
+    mutable std::vector<const JobOpHot*> _ops;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,11 +49,20 @@ ScheduleEvaluator::initialize(const gop::IndEvaluatorConfiguration* p_cf)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 Score*
-ScheduleEvaluator::eval(const gop::IndBuilderContext* p_context) const
+ScheduleEvaluator::eval(const gop::IndBuilderContext* context) const
+{
+    Score* score = new Score();
+    eval(context, *score);
+    return score;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ScheduleEvaluator::eval(const gop::IndBuilderContext* p_context, Score& score) const
 {
     ASSERTD(dynamic_cast<const SchedulingContext*>(p_context) != nullptr);
     const SchedulingContext* context = (const SchedulingContext*)p_context;
-    Score* score = new Score();
     uint_t numUnscheduledOps = context->clevorDataSet()->sops().size() - context->numScheduledOps();
 
     // construction failed?
@@ -81,24 +90,23 @@ ScheduleEvaluator::eval(const gop::IndBuilderContext* p_context) const
         }
         utl::cout << utl::endl;
 #endif
-        score->setValue(numUnscheduledOps);
-        score->setType(score_failed);
-        return score;
+        score.setValue(numUnscheduledOps);
+        score.setType(score_failed);
+        return;
     }
 
     // hard constraint violation?
     uint_t ctScore = context->hardCtScore();
     if (ctScore != 0)
     {
-        score->setValue(ctScore);
-        score->setType(score_ct_violated);
-        return score;
+        score.setValue(ctScore);
+        score.setType(score_ct_violated);
+        return;
     }
 
     // construction was successful
-    score->setType(score_succeeded);
-    score->setValue(calcScore(context));
-    return score;
+    score.setType(score_succeeded);
+    score.setValue(calcScore(context));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@ public:
 
     virtual gop::Score* eval(const gop::IndBuilderContext* context) const;
 
+    virtual void eval(const gop::IndBuilderContext* context, gop::Score& score) const;
+
     virtual double calcScore(const gop::IndBuilderContext* context) const = 0;
 
 protected:
@@ -0,0 +1,280 @@
+#include "libcse.h"
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "DiscreteResource.h"
+#include "ScheduleExport.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(cse::ScheduleExport);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// prefix of the names of the shared-memory objects that we write
+static const char* shmPrefix = "/clevor_export.";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool
+validName(const std::string& name)
+{
+    if (name.empty() || (name[0] == '.'))
+    {
+        return false;
+    }
+    for (char c : name)
+    {
+        if (!isalnum((unsigned char)c) && (c != '.') && (c != '_') && (c != '-'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ScheduleExport::build(const ClevorDataSet* dataSet)
+{
+    // per-op columns
+    auto& ops = dataSet->ops();
+    uint_t numOps = ops.size();
+    std::vector<uint32_t> opIds, pts, remainingPts, assignIdx, assignResIds, assignCaps;
+    std::vector<uint8_t> flags, scheduledBys;
+    std::vector<int64_t> starts, ends, resumes;
+    opIds.reserve(numOps);
+    flags.reserve(numOps);
+    scheduledBys.reserve(numOps);
+    pts.reserve(numOps);
+    remainingPts.reserve(numOps);
+    starts.reserve(numOps);
+    ends.reserve(numOps);
+    resumes.reserve(numOps);
+    assignIdx.reserve(numOps + 1);
+    for (auto op : ops)
+    {
+        opIds.push_back(op->id());
+        assignIdx.push_back(assignResIds.size());
+
+        // op is not scheduled -> zeroes
+        bool scheduled = !op->ignorable() && op->isScheduled() && (op->scheduledBy() == sa_clevor);
+        if (!scheduled)
+        {
+            flags.push_back(0);
+            scheduledBys.push_back(0);
+            pts.push_back(0);
+            remainingPts.push_back(0);
+            starts.push_back(0);
+            ends.push_back(0);
+            resumes.push_back(0);
+            continue;
+        }
+
+        // scheduling details
+        flags.push_back(1 | (op->frozen() ? 2 : 0));
+        scheduledBys.push_back(op->scheduledBy());
+        pts.push_back(op->scheduledProcessingTime());
+        remainingPts.push_back(op->scheduledRemainingPt());
+        starts.push_back(op->scheduledStartTime());
+        ends.push_back(op->scheduledEndTime());
+        resumes.push_back(op->scheduledResumeTime());
+
+        // resource assignments
+        uint_t numResReqs = op->numResReqs();
+        for (uint_t i = 0; i != numResReqs; ++i)
+        {
+            auto rr = op->getResReq(i);
+            assignResIds.push_back(rr->resourceId());
+            assignCaps.push_back(rr->scheduledCapacity());
+        }
+        uint_t numResGroupReqs = op->numResGroupReqs();
+        for (uint_t i = 0; i != numResGroupReqs; ++i)
+        {
+            auto rgr = op->getResGroupReq(i);
+            assignResIds.push_back(rgr->scheduledResourceId());
+            assignCaps.push_back(rgr->scheduledCapacity());
+        }
+    }
+    assignIdx.push_back(assignResIds.size());
+
+    // resource costs
+    std::vector<uint32_t> resCostIds;
+    std::vector<double> resCosts;
+    for (auto res : dataSet->resources())
+    {
+        if (!res->isA(cse::DiscreteResource))
+        {
+            continue;
+        }
+        auto dres = utl::cast<cse::DiscreteResource>(res);
+        if (dres->cost() == nullptr)
+        {
+            continue;
+        }
+        resCostIds.push_back(dres->id());
+        resCosts.push_back(dres->cost()->cost());
+    }
+
+    // header, then the columns
+    _image.assign(sizeof(Header), 0);
+    addColumn(col_opId, opIds);
+    addColumn(col_flags, flags);
+    addColumn(col_scheduledBy, scheduledBys);
+    addColumn(col_pt, pts);
+    addColumn(col_remainingPt, remainingPts);
+    addColumn(col_start, starts);
+    addColumn(col_end, ends);
+    addColumn(col_resume, resumes);
+    addColumn(col_assignIdx, assignIdx);
+    addColumn(col_assignResId, assignResIds);
+    addColumn(col_assignCap, assignCaps);
+    addColumn(col_resCostId, resCostIds);
+    addColumn(col_resCost, resCosts);
+
+    auto header = (Header*)_image.data();
+    memcpy(header->magic, "CSESCHED", 8);
+    header->version = 1;
+    header->numOps = numOps;
+    header->numAssignments = assignResIds.size();
+    header->numResCosts = resCostIds.size();
+    header->size = _image.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ScheduleExport::write(const std::string& target, const std::string& exportDir)
+{
+    _errorMsg.clear();
+
+    // the name can't leave the export directory, and a shared-memory object's name is given our
+    // prefix (so a client can only replace objects that were exported by a server)
+    bool shm = (target.compare(0, 4, "shm:") == 0);
+    std::string name = target;
+    if (shm)
+    {
+        name = (target.compare(0, 5, "shm:/") == 0) ? target.substr(5) : "";
+    }
+    if (!validName(name) || (name.find("..") != std::string::npos))
+    {
+        _errorMsg = "invalid target name: " + target;
+        return false;
+    }
+    if (!shm && exportDir.empty())
+    {
+        _errorMsg = "no export directory for " + target + " (use shm:/name)";
+        return false;
+    }
+
+    // shared-memory object: re-create it, and write the header last
+    if (shm)
+    {
+        name = shmPrefix + name;
+        shm_unlink(name.c_str());
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd < 0)
+        {
+            _errorMsg = "cannot open " + target + ": " + strerror(errno);
+            return false;
+        }
+        bool res = (ftruncate(fd, _image.size()) == 0) &&
+                   (lseek(fd, sizeof(Header), SEEK_SET) == (off_t)sizeof(Header)) &&
+                   writeAll(fd, _image.data() + sizeof(Header), _image.size() - sizeof(Header)) &&
+                   (lseek(fd, 0, SEEK_SET) == 0) && writeAll(fd, _image.data(), sizeof(Header));
+        if (!res)
+        {
+            _errorMsg = "cannot write " + target + ": " + strerror(errno);
+            shm_unlink(name.c_str());
+        }
+        close(fd);
+        return res;
+    }
+
+    // file: write a temporary file, then rename it
+    std::string path = exportDir + "/" + name;
+    std::string tmpPath = exportDir + "/." + name + ".XXXXXX";
+    std::vector<char> tmpPathBuf(tmpPath.begin(), tmpPath.end());
+    tmpPathBuf.push_back('\0');
+    int fd = mkstemp(tmpPathBuf.data());
+    if (fd < 0)
+    {
+        _errorMsg = "cannot open " + target + ": " + strerror(errno);
+        return false;
+    }
+    bool res = (fchmod(fd, 0644) == 0) && writeAll(fd, _image.data(), _image.size()) &&
+               (fsync(fd) == 0);
+    if (close(fd) != 0)
+    {
+        res = false;
+    }
+    if (res && (rename(tmpPathBuf.data(), path.c_str()) != 0))
+    {
+        res = false;
+    }
+    if (!res)
+    {
+        _errorMsg = "cannot write " + target + ": " + strerror(errno);
+        unlink(tmpPathBuf.data());
+    }
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ScheduleExport::writeAll(int fd, const char* ptr, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t numWritten = ::write(fd, ptr, size);
+        if (numWritten < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        ptr += numWritten;
+        size -= numWritten;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void
+ScheduleExport::addColumn(column_t col, const std::vector<T>& values)
+{
+    // columns start at 8-byte boundaries
+    size_t offset = (_image.size() + 7) & ~(size_t)7;
+    size_t numBytes = values.size() * sizeof(T);
+    _image.resize(offset + numBytes, 0);
+    if (numBytes > 0)
+    {
+        memcpy(_image.data() + offset, values.data(), numBytes);
+    }
+    ((Header*)_image.data())->offsets[col] = offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_END;
@@ -0,0 +1,129 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cse/ClevorDataSet.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Columnar binary image of a schedule (for the `exportBestSchedule` command).
+
+   The image carries the same information as the `getBestSchedule` response, laid out so that a
+   reader can mmap it and use each column in place:
+
+   - header: ScheduleExport::Header (magic "CSESCHED", version, counts, column offsets)
+   - one column (array) per field, each starting at an 8-byte aligned offset from the start of
+     the image (see \ref column_t for the columns and their element types)
+
+   Per-op columns are indexed by the op's position in ClevorDataSet::ops() (ordered by op id).
+   An op's resource assignments are the entries [assignIdx[i], assignIdx[i+1]) of the
+   assignment columns (compressed sparse rows), with resource requirements before
+   resource-group requirements.  Ops that weren't scheduled by Clevor have a zero flags entry,
+   zeroes in the other per-op columns, and no assignments.
+
+   All values are in the host's byte order.
+
+   \ingroup cse
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ScheduleExport : public utl::Object
+{
+    UTL_CLASS_DECL(ScheduleExport, utl::Object);
+    UTL_CLASS_NO_COPY;
+
+public:
+    /** Column. */
+    enum column_t
+    {
+        col_opId = 0,        /**< op id (uint32) */
+        col_flags = 1,       /**< 1 = scheduled, 2 = frozen (uint8) */
+        col_scheduledBy = 2, /**< scheduling agent (uint8, see scheduling_agent_t) */
+        col_pt = 3,          /**< processing time (uint32) */
+        col_remainingPt = 4, /**< remaining processing time (uint32) */
+        col_start = 5,       /**< start time (int64, time_t) */
+        col_end = 6,         /**< end time (int64, time_t) */
+        col_resume = 7,      /**< resume time (int64, time_t) */
+        col_assignIdx = 8,   /**< first assignment of each op (uint32, numOps + 1 entries) */
+        col_assignResId = 9, /**< assigned resource id (uint32) */
+        col_assignCap = 10,  /**< assigned capacity (uint32) */
+        col_resCostId = 11,  /**< DiscreteResource id (uint32) */
+        col_resCost = 12,    /**< DiscreteResource cost (double) */
+        col_undefined = 13   /**< number of columns */
+    };
+
+    /** Header. */
+    struct Header
+    {
+        char magic[8];                   /**< "CSESCHED" */
+        uint32_t version;                /**< format version (1) */
+        uint32_t numOps;                 /**< number of ops */
+        uint32_t numAssignments;         /**< number of resource assignments */
+        uint32_t numResCosts;            /**< number of DiscreteResource costs */
+        uint64_t size;                   /**< size of the image in bytes */
+        uint64_t offsets[col_undefined]; /**< offset of each column */
+    };
+
+public:
+    /** Build the image of the data-set's schedule (see Server's getBestSchedule command). */
+    void build(const ClevorDataSet* dataSet);
+
+    /**
+       Write the image.
+
+       A file is written to a temporary file in the export directory, and then renamed, so
+       readers never see a partial image.  A shared-memory object is re-created (readers that
+       already mapped the old object keep it), and its header is written last: readers should
+       check the magic (and size) before using the image.
+
+       \return true if successful, false otherwise (see errorMsg)
+       \param target "shm:/name" for the POSIX shared-memory object "/clevor_export.name", or
+                     the name of a file in exportDir (a name is letters, digits, '.', '_' and
+                     '-', and can't begin with '.' or contain "..")
+       \param exportDir directory for files (empty = only shared-memory objects are allowed)
+    */
+    bool write(const std::string& target, const std::string& exportDir);
+
+    /** Get the image's size in bytes. */
+    size_t
+    size() const
+    {
+        return _image.size();
+    }
+
+    /** Get the error message (see write). */
+    const std::string&
+    errorMsg() const
+    {
+        return _errorMsg;
+    }
+
+private:
+    void
+    init()
+    {
+    }
+    void
+    deInit()
+    {
+    }
+
+    template <typename T>
+    void addColumn(column_t col, const std::vector<T>& values);
+
+    bool writeAll(int fd, const char* ptr, size_t size);
+
+private:
+    std::vector<char> _image;
+    std::string _errorMsg;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSE_NS_END;
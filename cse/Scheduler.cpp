@@ -66,6 +66,18 @@ Scheduler::setStringBase(gop::Operator* op) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Scheduler::getSequenceSegments(const gop::DataSet* dataSet,
+                               gop::string_segment_vector_t& segments) const
+{
+    if (_nestedScheduler != nullptr)
+    {
+        _nestedScheduler->getSequenceSegments(dataSet, segments);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 Scheduler::setConfig(SchedulerConfiguration* config)
 {
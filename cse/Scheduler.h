@@ -37,6 +37,9 @@ public:
 
     virtual void setStringBase(gop::Operator* op) const;
 
+    virtual void getSequenceSegments(const gop::DataSet* dataSet,
+                                     gop::string_segment_vector_t& segments) const;
+
     /** Set the scheduler configuration. */
     void setConfig(SchedulerConfiguration* config);
 
@@ -1,12 +1,14 @@
 #include "libcse.h"
 #include <libutl/Time.h>
 #include <libutl/BufferedFDstream.h>
+#include <gop/ConfigEx.h>
 #include "SchedulerConfiguration.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 UTL_NS_USE;
 LUT_NS_USE;
+GOP_NS_USE;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -18,6 +20,11 @@ CSE_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// serialization format version (see SchedulerConfiguration)
+static const uint_t formatVersion = 4;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 SchedulerConfiguration::copy(const Object& rhs)
 {
@@ -29,6 +36,10 @@ SchedulerConfiguration::copy(const Object& rhs)
     _autoFreezeDuration = cf._autoFreezeDuration;
     _useInitialAsSeed = cf._useInitialAsSeed;
     _backward = cf._backward;
+    _energeticReasoning = cf._energeticReasoning;
+    _setupsInConstruction = cf._setupsInConstruction;
+    _decompose = cf._decompose;
+    _rollingHorizonDuration = cf._rollingHorizonDuration;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +47,13 @@ SchedulerConfiguration::copy(const Object& rhs)
 void
 SchedulerConfiguration::serialize(Stream& stream, uint_t io, uint_t)
 {
+    // the format version comes first
+    uint_t version = formatVersion;
+    utl::serialize(version, stream, io);
+    if (version > formatVersion)
+    {
+        throw ConfigEx();
+    }
     lut::serialize(_originTime, stream, io);
     lut::serialize(_horizonTime, stream, io);
     utl::serialize(_timeStep, stream, io);
@@ -43,6 +61,22 @@ SchedulerConfiguration::serialize(Stream& stream, uint_t io, uint_t)
     utl::serialize(_autoFreezeDuration, stream, io);
     utl::serialize(_useInitialAsSeed, stream, io);
     utl::serialize(_backward, stream, io);
+    if (version >= 1)
+    {
+        utl::serialize(_energeticReasoning, stream, io);
+    }
+    if (version >= 2)
+    {
+        utl::serialize(_setupsInConstruction, stream, io);
+    }
+    if (version >= 3)
+    {
+        utl::serialize(_decompose, stream, io);
+    }
+    if (version >= 4)
+    {
+        utl::serialize(_rollingHorizonDuration, stream, io);
+    }
     if (io == io_rd)
     {
         int remainder = (_horizonTime - _originTime) % _timeStep;
@@ -197,6 +231,10 @@ SchedulerConfiguration::init()
     _autoFreezeDuration = 0;
     _useInitialAsSeed = false;
     _backward = false;
+    _energeticReasoning = false;
+    _setupsInConstruction = false;
+    _decompose = false;
+    _rollingHorizonDuration = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
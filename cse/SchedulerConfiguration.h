@@ -9,6 +9,15 @@ CSE_NS_BEGIN;
 /**
    Scheduler configuration.
 
+   A serialized SchedulerConfiguration begins with its format version, so a stream in an older
+   format can still be read (the settings that were added since keep their default values):
+
+   - 0 : original format
+   - 1 : adds energeticReasoning
+   - 2 : adds setupsInConstruction
+   - 3 : adds decompose
+   - 4 : adds rollingHorizonDuration
+
    \ingroup cse
 */
 
@@ -101,6 +110,49 @@ public:
     {
         return _backward;
     }
+
+    /** Get energetic-reasoning flag (see cls::DiscreteResourceEnergyCt). */
+    bool
+    energeticReasoning() const
+    {
+        return _energeticReasoning;
+    }
+
+    /**
+       Get setups-in-construction flag.
+       If true, sequence-dependent setups on unary resources are respected while each op is
+       scheduled (see cls::ResourceSetupTimes), instead of being imposed on the complete schedule
+       (forward scheduling only).
+    */
+    bool
+    setupsInConstruction() const
+    {
+        return _setupsInConstruction;
+    }
+
+    /**
+       Get decompose flag.
+       If true, an optimization run whose jobs form independent sub-problems (see
+       ClevorDataSet::decompose) optimizes each sub-problem in its own run, in parallel
+       (forward scheduling with a single objective only).
+    */
+    bool
+    decompose() const
+    {
+        return _decompose;
+    }
+
+    /**
+       Get the rolling-horizon window duration (0 if the whole horizon is optimized at once).
+       If non-zero, an optimization run optimizes one window of this duration at a time (see
+       ClevorDataSet::horizonWindow), freezing each window's ops that start before the next
+       window (forward scheduling with a single objective only).
+    */
+    uint_t
+    rollingHorizonDuration() const
+    {
+        return _rollingHorizonDuration;
+    }
     //@}
 
     /// \name Accessors (non-const)
@@ -153,6 +205,34 @@ public:
     {
         _backward = backward;
     }
+
+    /** Set energetic-reasoning flag. */
+    void
+    setEnergeticReasoning(bool energeticReasoning)
+    {
+        _energeticReasoning = energeticReasoning;
+    }
+
+    /** Set setups-in-construction flag. */
+    void
+    setSetupsInConstruction(bool setupsInConstruction)
+    {
+        _setupsInConstruction = setupsInConstruction;
+    }
+
+    /** Set decompose flag. */
+    void
+    setDecompose(bool decompose)
+    {
+        _decompose = decompose;
+    }
+
+    /** Set the rolling-horizon window duration. */
+    void
+    setRollingHorizonDuration(uint_t rollingHorizonDuration)
+    {
+        _rollingHorizonDuration = rollingHorizonDuration;
+    }
     //@}
 
     /// \name Convert between time_t (or seconds) and time-slots
@@ -191,6 +271,10 @@ private:
     uint_t _autoFreezeDuration;
     bool _useInitialAsSeed;
     bool _backward;
+    bool _energeticReasoning;
+    bool _setupsInConstruction;
+    bool _decompose;
+    uint_t _rollingHorizonDuration;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
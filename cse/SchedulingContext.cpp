@@ -3,12 +3,15 @@
 #include <libutl/Time.h>
 #include <clp/BoundCt.h>
 #include <clp/FailEx.h>
+#include <cls/CapExpMgr.h>
 #include <cls/CompositeResourceRequirement.h>
+#include <cls/DiscreteResourceEnergyCt.h>
 #include <cls/DiscreteResourceRequirement.h>
 #include <cls/ESbound.h>
 #include <cls/ESboundInt.h>
 #include <cls/ResourceCalendarMgr.h>
 #include <gop/ConfigEx.h>
+#include <gop/RunStatus.h>
 #include "CompositeResource.h"
 #include "ClevorDataSet.h"
 #include "DiscreteResource.h"
@@ -86,11 +89,44 @@ SchedulingContext::initialize(ClevorDataSet* dataSet)
     // schedule frozen ops
     scheduleFrozenOps();
 
+    // check the score bound (if any) after every 1/16th of the ops is scheduled
+    _scoreBoundInterval = utl::max((uint_t)1, (uint_t)(_dataSet->sops().size() / 16));
+
     _initialized = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+IndBuilderContext*
+SchedulingContext::makeWorkerContext() const
+{
+    ASSERTD(_initialized);
+    if (!_dataSet->jobGroups().empty())
+    {
+        return nullptr;
+    }
+    auto context = new SchedulingContext();
+    context->initialize(lut::clone(_dataSet));
+    context->setDataSetOwner(true);
+    return context;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingContext::updateRunStatus(RunStatus* runStatus) const
+{
+    if (_schedule == nullptr)
+    {
+        return;
+    }
+    auto capExpMgr = _schedule->capExpMgr();
+    runStatus->updateCapExps(capExpMgr->numLive(), capExpMgr->numTouched(),
+                             capExpMgr->numCapExps());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 SchedulingContext::clear()
 {
@@ -114,6 +150,9 @@ SchedulingContext::clear()
     // init numScheduledOps
     _numScheduledOps = 0;
 
+    // start counting touched capacity-expressions for this run
+    _schedule->capExpMgr()->clearStats();
+
     // restore jobs / ops
     auto& jobs = _dataSet->jobs();
     for (auto job : jobs)
@@ -146,30 +185,8 @@ SchedulingContext::clear()
         }
 
         // clear res's ResourceSequenceRuleApplications
+        // (res's unary timetable was restored by backtracking: only frozen activities remain)
         res->sequenceRuleApplications().clear();
-
-        // res has no scheduled activities -> skip
-        auto clsRes = res->clsResource();
-        if ((clsRes == nullptr) || (clsRes->actsByStartTime().size() == 0))
-        {
-            continue;
-        }
-
-        // remove non-frozen activities from res's activities-by-start-time
-        auto it = clsRes->actsByStartTime().begin();
-        while (it != clsRes->actsByStartTime().end())
-        {
-            auto act = *it;
-            auto op = utl::cast<JobOp>(act->owner());
-            if (op->frozen())
-            {
-                ++it;
-            }
-            else
-            {
-                it = clsRes->actsByStartTime().erase(it);
-            }
-        }
     }
 }
 
@@ -196,6 +213,12 @@ SchedulingContext::schedule(JobOp* op)
         _mgr->propagate();
     }
 
+    // energetic reasoning on the resources that act uses
+    if (_config->energeticReasoning())
+    {
+        checkEnergy(act);
+    }
+
 #ifdef DEBUG_UNIT
     if (op->id() == 89 || op->id() == 66 || op->id() == 380 || op->id() == 58)
         utl::cout << "schedule op-" << op->id() << " @ "
@@ -205,6 +228,53 @@ SchedulingContext::schedule(JobOp* op)
 #endif
 
     ++_numScheduledOps;
+
+    // schedule can't be accepted -> abandon it
+    if (scoreBounded() && ((_numScheduledOps % _scoreBoundInterval) == 0) && checkScoreBound())
+    {
+        throw FailEx();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int
+SchedulingContext::makespanLowerBound() const
+{
+    int makespan = _frozenMakespan;
+    for (auto job : _dataSet->jobs())
+    {
+        // skip job with id 0 (see calculateMakespan)
+        if (job->id() == 0)
+        {
+            continue;
+        }
+        makespan = utl::max(makespan, job->makespanLowerBound());
+    }
+    return makespan;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingContext::checkEnergy(const Activity* act)
+{
+    // note: only act's resources are checked -- changes to other resources' activities will be
+    //       detected when one of them is scheduled
+    for (auto resId : act->allResIds())
+    {
+        auto res = _dataSet->findResource(resId);
+        if (res == nullptr)
+        {
+            continue;
+        }
+        auto clsRes = dynamic_cast<cls::DiscreteResource*>(res->clsResource());
+        if ((clsRes == nullptr) || (clsRes->energyCt() == nullptr))
+        {
+            continue;
+        }
+        clsRes->energyCt()->execute();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +586,7 @@ SchedulingContext::init()
     _frozenMakespan = 0;
     _hardCtScore = 0;
     _numScheduledOps = 0;
+    _scoreBoundInterval = 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -898,19 +969,30 @@ SchedulingContext::onComplete()
 {
     ASSERTD(_sjobs.size() == 0);
 #ifdef DEBUG_UNIT
-    utl::cout << "This run is completed!" << utl::endlf;
+    auto capExpMgr = _schedule->capExpMgr();
+    utl::cout << "This run is completed!"
+              << " capExps (live/touched/total): " << capExpMgr->numLive() << "/"
+              << capExpMgr->numTouched() << "/" << capExpMgr->numCapExps() << utl::endlf;
 #endif
     _hardCtScore = _dataSet->hardCtScore();
 
     // data-set has ResourceSequenceLists?
     if (!_dataSet->resourceSequenceLists().empty())
     {
-        // add BoundCts for activities scheduled on unary resources
-        postUnaryResourceFS();
+        // setups were respected during construction -> only find the applications (for costs)
+        if (_config->setupsInConstruction() && _config->forward())
+        {
+            findResourceSequenceRuleApplications();
+        }
+        else
+        {
+            // add BoundCts for activities scheduled on unary resources
+            postUnaryResourceFS();
 
-        // find ResourceSequenceRule applications, post delays for them
-        findResourceSequenceRuleApplications();
-        postResourceSequenceDelays();
+            // find ResourceSequenceRule applications, post delays for them
+            findResourceSequenceRuleApplications();
+            postResourceSequenceDelays();
+        }
     }
 
     // calculate makespan and frozen-makespan
@@ -966,7 +1048,7 @@ SchedulingContext::postUnaryResourceFS()
 
         // add F-S relationship for activities scheduled on the resource
         Activity* lhsAct = nullptr;
-        const act_set_es_t& acts = clsRes->actsByStartTime();
+        auto& acts = clsRes->unaryTimetable();
         for (auto rhsAct : acts)
         {
             // first iteration -> only set lhsAct
@@ -1034,7 +1116,7 @@ SchedulingContext::findResourceSequenceRuleApplications()
         // show activities scheduled on the resource
         utl::cout << utl::endlf << "SchedulingContext::findResourceSequenceRuleApplications()"
                   << utl::endlf;
-        auto& debug_acts = clsRes->actsByStartTime();
+        auto& debug_acts = clsRes->unaryTimetable();
         for (auto act : debug_acts)
         {
             auto op = utl::cast<JobOp>(act->owner());
@@ -1046,7 +1128,7 @@ SchedulingContext::findResourceSequenceRuleApplications()
 
         // impose delays based on rules in sequence-list
         Activity* lhsAct = nullptr;
-        auto& acts = clsRes->actsByStartTime();
+        auto& acts = clsRes->unaryTimetable();
         for (auto rhsAct : acts)
         {
             // first iteration -> only set lhsAct
@@ -50,6 +50,15 @@ public:
     /** Prepare to generate a new schedule. */
     virtual void clear();
 
+    /**
+       Make a worker context that schedules a copy of the data-set.
+       Job groups are not copied with the data-set, so nullptr is returned if there are any.
+    */
+    virtual gop::IndBuilderContext* makeWorkerContext() const;
+
+    /** Add the capacity-expression statistics (see cls::CapExpMgr) to the run status. */
+    virtual void updateRunStatus(gop::RunStatus* runStatus) const;
+
     /** Schedule the given operation. */
     void schedule(JobOp* op);
 
@@ -124,6 +133,12 @@ public:
     {
         return _makespan;
     }
+
+    /**
+       Get a lower bound on the makespan (as time-slot) of a partial forward schedule.
+       \see Job::makespanLowerBound
+    */
+    int makespanLowerBound() const;
     //@}
 
     /// \name Accessors (non-const)
@@ -218,6 +233,7 @@ private:
     void postUnaryResourceFS();
     void findResourceSequenceRuleApplications();
     void postResourceSequenceDelays();
+    void checkEnergy(const cls::Activity* act);
     void propagate();
 
 private:
@@ -241,6 +257,7 @@ private:
     int _frozenMakespan;
     uint_t _hardCtScore;
     uint_t _numScheduledOps;
+    uint_t _scoreBoundInterval; // #/scheduled ops between score bound checks
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3,8 +3,14 @@
 #include <libutl/Float.h>
 #include <libutl/Duration.h>
 #include <clp/FailEx.h>
+#include <gop/ParallelObjectiveEvaluator.h>
 #include "SchedulingRun.h"
 #include "TotalCostEvaluator.h"
+#undef new
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <libutl/gblnew_macros.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -24,11 +30,23 @@ CSE_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/** Wall-clock time (in seconds). */
+static double
+wallTime()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(now).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 SchedulingRun::initialize(ClevorDataSet* dataSet,
                           Scheduler* scheduler,
-                          const objective_vector_t& objectives)
+                          const objective_vector_t& objectives,
+                          uint_t numThreads)
 {
+    clearComponents();
     delete _optimizer;
     _optimizer = nullptr;
 
@@ -44,8 +62,20 @@ SchedulingRun::initialize(ClevorDataSet* dataSet,
     deleteCont(_objectives);
     _objectives = objectives;
 
+    // thread budget
+    _numThreads = utl::max(numThreads, (uint_t)1);
+    limitThreads(_objectives);
+    dataSet->setNumThreads(_numThreads);
+
     // initialize context
     _context->initialize(dataSet);
+
+    // audit sections are collected on demand
+    auto tce = totalCostEvaluator();
+    if (tce != nullptr)
+    {
+        tce->setAuditSections(0);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,10 +85,16 @@ SchedulingRun::initialize(ClevorDataSet* dataSet,
                           Optimizer* optimizer,
                           OptimizerConfiguration* optimizerConfig)
 {
+    clearComponents();
     delete _scheduler;
     _scheduler = nullptr;
     deleteCont(_objectives);
 
+    // thread budget
+    _numThreads = utl::max(optimizerConfig->numThreads(), (uint_t)1);
+    limitThreads(optimizerConfig->objectives());
+    dataSet->setNumThreads(_numThreads);
+
     // context
     delete _context;
     _context = new SchedulingContext();
@@ -68,9 +104,20 @@ SchedulingRun::initialize(ClevorDataSet* dataSet,
     delete _optimizer;
     _optimizer = optimizer;
 
-    // initialize context and optimizer
-    _context->initialize(dataSet);
-    _optimizer->initialize(optimizerConfig);
+    // initialize context and optimizer (unless there's a run for each window of the horizon,
+    // or for each independent sub-problem)
+    if (!rollHorizon(dataSet, optimizerConfig) && !decompose(dataSet, optimizerConfig))
+    {
+        _context->initialize(dataSet);
+        _optimizer->initialize(optimizerConfig);
+    }
+
+    // audit sections are collected on demand
+    auto tce = totalCostEvaluator();
+    if (tce != nullptr)
+    {
+        tce->setAuditSections(0);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,13 +137,20 @@ SchedulingRun::run()
         Score* score = nullptr;
         if (res)
         {
+            // evaluate the objectives in parallel (they only read the finished schedule)
             uint_t numObjectives = this->numObjectives();
-            for (uint_t i = 0; i != numObjectives; ++i)
+            for (auto obj : _objectives)
             {
-                auto obj = _objectives[i];
                 obj->indEvaluator()->auditNext();
-                score = obj->eval(_context);
-                obj->setBestScore(score);
+            }
+            score_vector_t scores(numObjectives, nullptr);
+            ParallelObjectiveEvaluator evaluator;
+            evaluator.initialize(utl::min(_numThreads, numObjectives));
+            evaluator.run(_context, _objectives, scores);
+            for (uint_t i = 0; i != numObjectives; ++i)
+            {
+                score = scores[i];
+                _objectives[i]->setBestScore(score);
             }
             // there should be only one objective
             utl::cout << "Forward, ";
@@ -122,6 +176,13 @@ SchedulingRun::run()
             _context->store();
         }
     }
+    else if (_decomposed)
+    {
+        startDeadline();
+        res = _rollingHorizon ? runWindows() : runComponents();
+        res = mergeComponents() && res;
+        return res;
+    }
     else
     {
         res = _optimizer->run();
@@ -143,6 +204,33 @@ SchedulingRun::stop()
     {
         _optimizer->stop();
     }
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    _stopped = true;
+    for (auto run : _components)
+    {
+        run->stop();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::setDeadline(uint_t deadline)
+{
+    if (_optimizer)
+    {
+        _optimizer->setDeadline(deadline);
+    }
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    double deadlineTime = wallTime() + (deadline / 1000.0);
+    if ((_deadline == 0.0) || (deadlineTime < _deadline))
+    {
+        _deadline = deadlineTime;
+    }
+    for (auto run : _components)
+    {
+        run->setDeadline(deadline);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,7 +238,7 @@ SchedulingRun::stop()
 void
 SchedulingRun::audit()
 {
-    if (_optimizer == nullptr)
+    if (ownObjectives())
     {
         return;
     }
@@ -162,7 +250,7 @@ SchedulingRun::audit()
 uint_t
 SchedulingRun::numObjectives() const
 {
-    if (_optimizer == nullptr)
+    if (ownObjectives())
     {
         return _objectives.size();
     }
@@ -185,7 +273,7 @@ SchedulingRun::makespan() const
 Score*
 SchedulingRun::bestScore(uint_t objectiveIdx) const
 {
-    if (_optimizer == nullptr)
+    if (ownObjectives())
     {
         ASSERTD(objectiveIdx < _objectives.size());
         return _objectives[objectiveIdx]->getBestScore();
@@ -201,7 +289,7 @@ SchedulingRun::bestScore(uint_t objectiveIdx) const
 Score*
 SchedulingRun::bestScore(const std::string& objectiveName) const
 {
-    if (_optimizer == nullptr)
+    if (ownObjectives())
     {
         for (uint_t i = 0; i != _objectives.size(); ++i)
         {
@@ -225,7 +313,7 @@ int
 SchedulingRun::bestScoreComponent(const std::string& objectiveName,
                                   const std::string& componentName) const
 {
-    if (_optimizer == nullptr)
+    if (ownObjectives())
     {
         for (uint_t i = 0; i != _objectives.size(); ++i)
         {
@@ -248,7 +336,8 @@ SchedulingRun::bestScoreComponent(const std::string& objectiveName,
 const std::string&
 SchedulingRun::bestScoreAudit() const
 {
-    if (_optimizer == nullptr)
+    collectAudit(audit_all);
+    if (ownObjectives())
     {
         auto objective = _objectives[0];
         auto& auditText = objective->indEvaluator()->auditText();
@@ -264,11 +353,47 @@ SchedulingRun::bestScoreAudit() const
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 const AuditReport*
-SchedulingRun::bestScoreAuditReport() const
+SchedulingRun::bestScoreAuditReport(uint_t sections) const
+{
+    collectAudit(sections);
+    auto tce = totalCostEvaluator();
+    return (tce == nullptr) ? nullptr : tce->auditReport();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::limitThreads(const objective_vector_t& objectives) const
+{
+    // TotalCostEvaluator objectives aren't evaluated at the same time as other objectives
+    // (see IndEvaluator::sharesState), so each one's threads can have the whole budget
+    for (auto objective : objectives)
+    {
+        auto evaluator = objective->indEvaluator();
+        if (!evaluator->isA(TotalCostEvaluator))
+        {
+            continue;
+        }
+        auto tce = utl::cast<TotalCostEvaluator>(evaluator);
+        if (tce->numThreads() > _numThreads)
+        {
+            tce->setNumThreads(_numThreads);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TotalCostEvaluator*
+SchedulingRun::totalCostEvaluator() const
 {
     gop::Objective* objective = nullptr;
-    if (_optimizer == nullptr)
+    if (ownObjectives())
     {
+        if (_objectives.empty())
+        {
+            return nullptr;
+        }
         objective = _objectives[0];
     }
     else
@@ -279,20 +404,447 @@ SchedulingRun::bestScoreAuditReport() const
     auto evaluator = objective->indEvaluator();
     if (evaluator->isA(TotalCostEvaluator))
     {
-        auto tce = utl::cast<TotalCostEvaluator>(evaluator);
-        return tce->auditReport();
+        return utl::cast<TotalCostEvaluator>(evaluator);
     }
     return nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+SchedulingRun::collectAudit(uint_t sections) const
+{
+    // no audit of the best schedule (yet), or the report already has the requested sections?
+    auto tce = totalCostEvaluator();
+    auto report = (tce == nullptr) ? nullptr : tce->auditReport();
+    if ((report == nullptr) || ((report->sections() & sections) == sections))
+    {
+        return;
+    }
+
+    // re-audit the best schedule, keeping the sections we already have
+    tce->setAuditSections(report->sections() | sections);
+    if (ownObjectives())
+    {
+        // (the context of a decomposed run still holds the combined schedule)
+        auto objective = _objectives[0];
+        if (!_decomposed)
+        {
+            _context->clear();
+            _scheduler->run(nullptr, _context);
+        }
+        objective->indEvaluator()->auditNext();
+        delete objective->eval(_context);
+    }
+    else
+    {
+        _optimizer->audit();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+SchedulingRun::decompose(ClevorDataSet* dataSet, OptimizerConfiguration* optimizerConfig)
+{
+    // the combined schedule is re-created with frozen ops (forward only), and its score is
+    // evaluated for a single objective
+    auto config = dataSet->schedulerConfig();
+    if (!config->decompose() || config->backward() || (optimizerConfig->objectives().size() != 1))
+    {
+        return false;
+    }
+
+    // not more than one sub-problem -> nothing to do
+    std::vector<ClevorDataSet*> dataSets;
+    uint_t numComponents = dataSet->decompose(dataSets);
+    if (numComponents <= 1)
+    {
+        return false;
+    }
+
+    // make a single-threaded run for each sub-problem (the runs share our thread budget)
+    // note: the wall-time limit is for the whole run (each sub-problem's run is given its share of
+    //       the remaining time when it starts), and the CPU-time limit is divided between them
+    _wallTimeLimit = optimizerConfig->wallTimeLimit();
+    uint_t cpuTimeLimit = optimizerConfig->cpuTimeLimit();
+    if (cpuTimeLimit != uint_t_max)
+    {
+        cpuTimeLimit = utl::max(cpuTimeLimit / numComponents, (uint_t)1);
+    }
+    for (uint_t i = 0; i != numComponents; ++i)
+    {
+        auto componentConfig = optimizerConfig->clone();
+        componentConfig->setNumThreads(1);
+        componentConfig->setWallTimeLimit(uint_t_max);
+        componentConfig->setCPUtimeLimit(cpuTimeLimit);
+        auto run = new SchedulingRun();
+        _components.push_back(run);
+        try
+        {
+            run->initialize(dataSets[i], _optimizer->clone(), componentConfig);
+        }
+        catch (...)
+        {
+            delete componentConfig;
+            for (uint_t j = i + 1; j != numComponents; ++j)
+            {
+                delete dataSets[j];
+            }
+            throw;
+        }
+        delete componentConfig;
+    }
+
+    // the combined schedule is evaluated by our own copy of the objective
+    _decomposed = true;
+    _dataSet = dataSet;
+    copyVector(_objectives, optimizerConfig->objectives());
+    updateComponentsRunStatus();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+SchedulingRun::rollHorizon(ClevorDataSet* dataSet, OptimizerConfiguration* optimizerConfig)
+{
+    // each window's schedule is frozen (forward only), and the last window's score is evaluated
+    // for a single objective (job-groups aren't split between windows)
+    auto config = dataSet->schedulerConfig();
+    if ((config->rollingHorizonDuration() == 0) || config->backward() ||
+        (optimizerConfig->objectives().size() != 1) || !dataSet->jobGroups().empty())
+    {
+        return false;
+    }
+
+    // the windows are made as the run goes (each one builds on the previous one's schedule)
+    _decomposed = true;
+    _rollingHorizon = true;
+    _dataSet = dataSet;
+    _optimizerConfig = optimizerConfig->clone();
+    _wallTimeLimit = optimizerConfig->wallTimeLimit();
+    copyVector(_objectives, optimizerConfig->objectives());
+    updateComponentsRunStatus();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+SchedulingRun::runWindows()
+{
+    auto config = _dataSet->schedulerConfig();
+    time_t horizonTime = config->horizonTime();
+    uint_t windowDuration = config->rollingHorizonDuration();
+    uint_t numJobs = _dataSet->jobs().size();
+
+    bool res = true;
+    SchedulingRun* prefixRun = nullptr;
+    time_t windowStart = config->originTime();
+    for (;;)
+    {
+        // the last window has every job (skip to it if we're stopped or out of time)
+        bool stopped;
+        {
+            std::lock_guard<std::mutex> lock(_componentsMutex);
+            stopped = _stopped || ((_deadline != 0.0) && (wallTime() >= _deadline));
+        }
+        time_t windowEnd = windowStart + windowDuration;
+        bool last = stopped || (windowEnd >= horizonTime);
+        auto prefix = (prefixRun == nullptr) ? nullptr : prefixRun->context()->clevorDataSet();
+        auto dataSet = _dataSet->horizonWindow(prefix, windowStart, last ? -1 : windowEnd);
+        uint_t numWindowJobs = dataSet->jobs().size();
+        last = last || (numWindowJobs == numJobs);
+
+        // no new jobs -> move on to the next window
+        uint_t numPrefixJobs = (prefix == nullptr) ? 0 : prefix->jobs().size();
+        if (!last && (numWindowJobs == numPrefixJobs))
+        {
+            delete dataSet;
+            windowStart = windowEnd;
+            continue;
+        }
+
+        // optimize the window
+        auto run = new SchedulingRun();
+        try
+        {
+            run->initialize(dataSet, _optimizer->clone(), _optimizerConfig);
+        }
+        catch (...)
+        {
+            delete run;
+            delete prefixRun;
+            throw;
+        }
+        startComponent(run);
+        try
+        {
+            res = runComponents();
+        }
+        catch (...)
+        {
+            delete prefixRun;
+            throw;
+        }
+
+        // the window's run is the next window's prefix
+        {
+            std::lock_guard<std::mutex> lock(_componentsMutex);
+            _components.clear();
+        }
+        if (prefixRun != nullptr)
+        {
+            bool complete;
+            uint_t iteration;
+            uint_t bestIter;
+            Score* bestScore;
+            prefixRun->optimizer()->runStatus()->get(complete, iteration, bestIter, bestScore);
+            _componentsIteration += iteration;
+            delete prefixRun;
+        }
+        prefixRun = run;
+        if (last)
+        {
+            break;
+        }
+        windowStart = windowEnd;
+    }
+
+    // the last window's schedule is the result
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    _components.push_back(prefixRun);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::startDeadline()
+{
+    // the wall-time limit is for the whole run
+    if (_wallTimeLimit == uint_t_max)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    double deadlineTime = wallTime() + (_wallTimeLimit / 1000.0);
+    if ((_deadline == 0.0) || (deadlineTime < _deadline))
+    {
+        _deadline = deadlineTime;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::shareDeadline(SchedulingRun* run, uint_t numShares)
+{
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    if (_deadline == 0.0)
+    {
+        return;
+    }
+    double remaining = utl::max(_deadline - wallTime(), 0.0);
+    run->setDeadline((uint_t)((remaining * 1000.0) / numShares));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::startComponent(SchedulingRun* run)
+{
+    // stop the run, or apply the deadline (if it was set before the run was made)
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    _components.push_back(run);
+    if (_stopped)
+    {
+        run->stop();
+    }
+    else if (_deadline != 0.0)
+    {
+        double remaining = utl::max(_deadline - wallTime(), 0.0);
+        run->setDeadline((uint_t)(remaining * 1000.0));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+SchedulingRun::runComponents()
+{
+    // run the sub-problems in parallel
+    uint_t numComponents = _components.size();
+    uint_vector_t feasible(numComponents, 0);
+    std::atomic<bool> done(false);
+    std::exception_ptr ex;
+    std::thread runner([&]() {
+        try
+        {
+            ThreadPool pool(utl::min(_numThreads, numComponents));
+            uint64_t numTasks = numComponents;
+            pool.run(numComponents, [&](uint_t componentIdx, uint_t threadIdx) {
+                // each thread runs a contiguous block of sub-problems (see ThreadPool::run)
+                // -> share the remaining time between the ones that are left in our block
+                uint_t blockEnd = (uint_t)((numTasks * (threadIdx + 1)) / pool.numThreads());
+                auto run = _components[componentIdx];
+                shareDeadline(run, blockEnd - componentIdx);
+                feasible[componentIdx] = run->run();
+            });
+        }
+        catch (...)
+        {
+            ex = std::current_exception();
+        }
+        done = true;
+    });
+
+    // report their combined progress until they're done
+    while (!done)
+    {
+        updateComponentsRunStatus();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    runner.join();
+    updateComponentsRunStatus();
+
+    // a sub-problem's run failed -> re-throw its exception
+    if (ex != nullptr)
+    {
+        std::rethrow_exception(ex);
+    }
+
+    // feasible only if every sub-problem's best schedule is feasible
+    return (std::find(feasible.begin(), feasible.end(), 0) == feasible.end());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+SchedulingRun::mergeComponents()
+{
+    // take the sub-problems' objects (with their best schedules)
+    {
+        std::lock_guard<std::mutex> lock(_componentsMutex);
+        std::vector<ClevorDataSet*> dataSets;
+        for (auto run : _components)
+        {
+            dataSets.push_back(run->context()->clevorDataSet());
+        }
+        _dataSet->merge(dataSets);
+        deleteCont(_components);
+    }
+
+    // remember which ops are frozen
+    std::vector<std::pair<JobOp*, bool>> opsFrozen;
+    for (auto job : _dataSet->jobs())
+    {
+        for (auto op : *job)
+        {
+            opsFrozen.push_back(std::make_pair(op, op->frozen()));
+        }
+    }
+
+    // re-create the combined schedule, with every op frozen at its scheduled time
+    auto objective = _objectives[0];
+    auto config = _dataSet->schedulerConfig()->clone();
+    config->setUseInitialAsSeed(true);
+    _dataSet->set(config);
+    auto dataSet = _dataSet;
+    _dataSet = nullptr;
+    bool res = true;
+    try
+    {
+        _context->initialize(dataSet);
+        _context->setComplete(true);
+
+        // evaluate the combined schedule
+        objective->indEvaluator()->auditNext();
+        objective->setBestScore(objective->eval(_context));
+    }
+    catch (FailEx&)
+    {
+        res = false;
+        objective->setBestScore(objective->worstPossibleScore());
+    }
+    config->setUseInitialAsSeed(false);
+    for (auto& opFrozen : opsFrozen)
+    {
+        opFrozen.first->frozen() = opFrozen.second;
+    }
+
+    // report the combined score
+    bool complete;
+    uint_t iteration;
+    uint_t bestIter;
+    Score* bestScore;
+    auto runStatus = _optimizer->runStatus();
+    runStatus->get(complete, iteration, bestIter, bestScore);
+    runStatus->update(true, iteration, bestIter, objective->getBestScore());
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::updateComponentsRunStatus()
+{
+    // iterations are summed over the sub-problems (the combined score isn't known until the end)
+    uint_t iteration = _componentsIteration;
+    uint_t bestIter = 0;
+    for (auto run : _components)
+    {
+        bool componentComplete;
+        uint_t componentIteration;
+        uint_t componentBestIter;
+        Score* componentBestScore;
+        run->optimizer()->runStatus()->get(componentComplete, componentIteration,
+                                           componentBestIter, componentBestScore);
+        iteration += componentIteration;
+        bestIter = utl::max(bestIter, _componentsIteration + componentBestIter);
+    }
+    auto worstScore = _objectives[0]->worstPossibleScore();
+    _optimizer->runStatus()->update(false, iteration, bestIter, worstScore);
+    delete worstScore;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SchedulingRun::clearComponents()
+{
+    std::lock_guard<std::mutex> lock(_componentsMutex);
+    deleteCont(_components);
+    delete _dataSet;
+    _dataSet = nullptr;
+    _decomposed = false;
+    _componentsIteration = 0;
+    delete _optimizerConfig;
+    _optimizerConfig = nullptr;
+    _rollingHorizon = false;
+    _stopped = false;
+    _deadline = 0.0;
+    _wallTimeLimit = uint_t_max;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 SchedulingRun::init()
 {
     _context = nullptr;
     _optimizer = nullptr;
     _scheduler = nullptr;
+    _numThreads = 1;
+    _decomposed = false;
+    _dataSet = nullptr;
+    _componentsIteration = 0;
+    _rollingHorizon = false;
+    _optimizerConfig = nullptr;
+    _stopped = false;
+    _deadline = 0.0;
+    _wallTimeLimit = uint_t_max;
 
 #ifdef UTL_GBLNEW_DEBUG
     atexit(memReportLeaks);
@@ -304,6 +856,7 @@ SchedulingRun::init()
 void
 SchedulingRun::deInit()
 {
+    clearComponents();
     delete _context;
     delete _optimizer;
     delete _scheduler;
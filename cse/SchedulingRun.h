@@ -16,6 +16,10 @@ CSE_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+class TotalCostEvaluator;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    Perform a scheduling run.
 
@@ -30,6 +34,42 @@ CSE_NS_BEGIN;
 
    After the run is complete, other functions such as \ref bestScore and \ref bestScoreAuditReport
    can be called to retrieve information about the best schedule that was found in the run.
+
+   If SchedulerConfiguration::decompose is set, an optimization run whose jobs form independent
+   sub-problems (see ClevorDataSet::decompose) makes one run per sub-problem, and executes them in
+   parallel.  When they're done, the sub-problems' best schedules are merged: each sub-problem's
+   objects (with their scheduling results) are moved back into the data set, and the context
+   re-creates the combined schedule from them (with every op frozen at its scheduled time).  The
+   run's objective is evaluated on the combined schedule, so queries about the best result see
+   one schedule with one (combined) score.
+
+   If SchedulerConfiguration::rollingHorizonDuration is non-zero, an optimization run optimizes
+   one window of the horizon at a time (see ClevorDataSet::horizonWindow).  Each window's run
+   only sequences the ops that can start in it (and the previous window's ops that start at or
+   after its start); the ops before it are frozen at their scheduled times, so they're placed
+   once when the window's context is initialized, and not in every iteration.  The last window
+   has every job, and its best schedule is taken over like a decomposed run's.  When the run is
+   stopped (or its deadline passes), it skips to the last window, and stops that window's
+   optimization after its initial schedule.
+
+   An optimization run's thread budget is OptimizerConfiguration::numThreads (a simple run's is
+   given to \ref initialize, by the server from Server::numThreads).  It limits every thread pool
+   that the run makes: the threads that evaluate a simple run's objectives, TotalCostEvaluator's
+   threads, the threads that compile the resource calendars (see ClevorDataSet::numThreads), and
+   the pool that executes a decomposed run's sub-problems.  The pools don't nest: a
+   TotalCostEvaluator objective is evaluated after the other objectives (see
+   ParallelObjectiveEvaluator), so its threads can have the whole budget.  Each sub-problem's run
+   has a single thread (so the runs that execute at the same time don't use more threads than the
+   budget), and each window of a rolling horizon is given the whole budget.
+
+   The wall-time limit of a decomposed run is for the whole run: each sub-problem's run is given its
+   share of the time that's left when it starts (the remaining time is divided between the
+   sub-problems that its thread has yet to execute).  The CPU-time limit is divided evenly between
+   the sub-problems.
+
+   When the objective is evaluated by TotalCostEvaluator, the run's own audit of the best schedule
+   only records component scores.  The audit text and report sections are collected when they're
+   first asked for (by re-auditing the best schedule).
      
    \see SchedulingContext
    \ingroup cse
@@ -50,10 +90,12 @@ public:
        \param dataSet related ClevorDataSet
        \param scheduler agent that will perform scheduling
        \param objectives Objective%s that will measure the resulting schedule's performance
+       \param numThreads thread budget
     */
     void initialize(ClevorDataSet* dataSet,
                     cse::Scheduler* scheduler,
-                    const gop::objective_vector_t& objectives);
+                    const gop::objective_vector_t& objectives,
+                    uint_t numThreads = 1);
 
     /**
        Initialize an optimization run.
@@ -71,6 +113,12 @@ public:
     /** Stop optimization run (this would be called from another thread). */
     void stop();
 
+    /**
+       Set a hard deadline for the optimization run (see gop::Optimizer::setDeadline).
+       \param deadline deadline (in milliseconds from now)
+    */
+    void setDeadline(uint_t deadline);
+
     /** Audit the best result. */
     void audit();
     //@}
@@ -111,6 +159,13 @@ public:
     /** Get number of objectives. */
     uint_t numObjectives() const;
 
+    /** Get the thread budget. */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
+
     /** Get makespan. */
     time_t makespan() const;
     //@}
@@ -146,18 +201,59 @@ public:
     /** Get audit text for the best result. */
     const std::string& bestScoreAudit() const;
 
-    /** Get audit report for the best result. */
-    const AuditReport* bestScoreAuditReport() const;
+    /**
+       Get audit report for the best result.
+       \param sections report sections to include (see audit_section_t)
+    */
+    const AuditReport* bestScoreAuditReport(uint_t sections = audit_report) const;
     //@}
 private:
     void init();
     void deInit();
 
+    /** Does the run evaluate _objectives itself (simple run, or decomposed run)? */
+    bool
+    ownObjectives() const
+    {
+        return (_optimizer == nullptr) || _decomposed;
+    }
+
+    TotalCostEvaluator* totalCostEvaluator() const;
+    void limitThreads(const gop::objective_vector_t& objectives) const;
+    void collectAudit(uint_t sections) const;
+
+    // decomposed run
+    bool decompose(ClevorDataSet* dataSet, gop::OptimizerConfiguration* optimizerConfig);
+    bool rollHorizon(ClevorDataSet* dataSet, gop::OptimizerConfiguration* optimizerConfig);
+    bool runComponents();
+    bool runWindows();
+    void startDeadline();
+    void shareDeadline(SchedulingRun* run, uint_t numShares);
+    void startComponent(SchedulingRun* run);
+    bool mergeComponents();
+    void updateComponentsRunStatus();
+    void clearComponents();
+
 private:
     SchedulingContext* _context;
     gop::Optimizer* _optimizer;
     cse::Scheduler* _scheduler;
     gop::objective_vector_t _objectives;
+    uint_t _numThreads;
+
+    // decomposed run
+    bool _decomposed;
+    ClevorDataSet* _dataSet; // until the sub-problems are merged
+    std::vector<SchedulingRun*> _components;
+    std::mutex _componentsMutex;
+    uint_t _componentsIteration; // iterations of finished windows
+
+    // rolling horizon
+    bool _rollingHorizon;
+    gop::OptimizerConfiguration* _optimizerConfig;
+    bool _stopped;
+    uint_t _wallTimeLimit; // for the whole run
+    double _deadline;      // wall time (or 0 if there's no deadline)
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
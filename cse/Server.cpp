@@ -5,10 +5,12 @@
 #include <gop/ConfigEx.h>
 #include <gop/Objective.h>
 #include <gop/Optimizer.h>
+#include <gop/ParetoSA.h>
 #include <gop/Score.h>
 #include "ClevorDataSet.h"
 #include "DiscreteResource.h"
 #include "RunningThread.h"
+#include "ScheduleExport.h"
 #include "Scheduler.h"
 #include "ScheduleEvaluatorConfiguration.h"
 #include "SchedulingRun.h"
@@ -197,6 +199,7 @@ Server::init(bool recording)
 {
     _exit = false;
     _recording = recording;
+    _numThreads = 1;
     addHandler("authorizeClient", &Server::handle_authorizeClient);
     addHandler("exit", &Server::handle_exit);
     addHandler("initSimpleRun", &Server::handle_initSimpleRun);
@@ -208,8 +211,11 @@ Server::init(bool recording)
     addHandler("getBestScoreAuditReport", &Server::handle_getBestScoreAuditReport);
     addHandler("getBestScoreComponent", &Server::handle_getBestScoreComponent);
     addHandler("getBestSchedule", &Server::handle_getBestSchedule);
+    addHandler("exportBestSchedule", &Server::handle_exportBestSchedule);
     addHandler("getMakespan", &Server::handle_getMakespan);
     addHandler("getTimetable", &Server::handle_getTimetable);
+    addHandler("getTimetableLoad", &Server::handle_getTimetableLoad);
+    addHandler("getParetoFront", &Server::handle_getParetoFront);
     addHandler("NOP", &Server::handle_NOP);
     addHandler("stop", &Server::handle_stop);
 }
@@ -348,7 +354,7 @@ Server::handle_initSimpleRun(SEclient* client, const Array& cmd)
     utl::String str;
     try
     {
-        client->run()->initialize(dataSet, scheduler, objectiveVector);
+        client->run()->initialize(dataSet, scheduler, objectiveVector, _numThreads);
     }
     catch (ConfigEx&)
     {
@@ -458,7 +464,7 @@ Server::handle_initOptimizerRun(SEclient* client, const Array& cmd)
 void
 Server::handle_run(SEclient* client, const utl::Array& cmd)
 {
-    if (cmd.size() != 1)
+    if ((cmd.size() != 1) && ((cmd.size() != 2) || !cmd(1).isA(Uint)))
     {
         clientDisconnect(client);
         return;
@@ -485,6 +491,10 @@ Server::handle_run(SEclient* client, const utl::Array& cmd)
     else
     {
         ASSERTD(client->runningThread() == nullptr);
+        if (cmd.size() == 2)
+        {
+            client->run()->setDeadline(utl::cast<Uint>(cmd(1)));
+        }
         client->createRunningThread();
         client->runningThread()->start(client->run());
     }
@@ -600,13 +610,21 @@ Server::handle_getBestScoreAudit(SEclient* client, const utl::Array& cmd)
 void
 Server::handle_getBestScoreAuditReport(SEclient* client, const utl::Array& cmd)
 {
-    if (cmd.size() != 1)
+    if ((cmd.size() > 2) || ((cmd.size() == 2) && !cmd(1).isA(Uint)))
     {
         clientDisconnect(client);
         return;
     }
 
-    auto report = client->run()->bestScoreAuditReport();
+    // report sections (all by default)
+    uint_t sections = audit_report;
+    if (cmd.size() == 2)
+    {
+        uint_t requested = utl::cast<Uint>(cmd(1));
+        sections = requested & audit_report;
+    }
+
+    auto report = client->run()->bestScoreAuditReport(sections);
     if (report == nullptr)
     {
         AuditReport().serializeOut(client->socket());
@@ -748,6 +766,30 @@ Server::handle_getBestSchedule(SEclient* client, const utl::Array& cmd)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Server::handle_exportBestSchedule(SEclient* client, const utl::Array& cmd)
+{
+    if ((cmd.size() != 2) || !cmd(1).isA(utl::String))
+    {
+        clientDisconnect(client);
+        return;
+    }
+
+    // build the image and write it to the target
+    std::string target = utl::cast<utl::String>(cmd(1)).get();
+    auto dataSet = client->run()->context()->clevorDataSet();
+    ScheduleExport schedExport;
+    schedExport.build(dataSet);
+    bool res = schedExport.write(target, _exportDir);
+
+    // write result, and the target (or error message)
+    Bool(res).serializeOut(client->socket());
+    utl::String(res ? target : schedExport.errorMsg()).serializeOut(client->socket());
+    finishCmd(client);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 Server::handle_getMakespan(SEclient* client, const utl::Array& cmd)
 {
@@ -813,6 +855,162 @@ Server::handle_getTimetable(SEclient* client, const utl::Array& cmd)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Server::handle_getTimetableLoad(SEclient* client, const utl::Array& cmd)
+{
+    if ((cmd.size() != 5) || !cmd(1).isA(Array) || !cmd(2).isA(Uint) || !cmd(3).isA(Uint) ||
+        !cmd(4).isA(Uint))
+    {
+        clientDisconnect(client);
+        return;
+    }
+
+    auto& resIds = utl::cast<Array>(cmd(1));
+    time_t beginTime = (uint_t)utl::cast<Uint>(cmd(2));
+    time_t endTime = (uint_t)utl::cast<Uint>(cmd(3));
+    uint_t bucketSeconds = utl::cast<Uint>(cmd(4));
+    auto context = client->run()->context();
+    auto dataSet = context->clevorDataSet();
+    auto& socket = client->socket();
+
+    // window and bucket width in time-slots (a bucket is at least one time-slot)
+    const uint_t maxBuckets = 65536;
+    uint_t timeStep = dataSet->schedulerConfig()->timeStep();
+    int beginTS = context->timeToTimeSlot(beginTime);
+    int endTS = context->timeToTimeSlot(endTime);
+    int bucketTS = utl::max((uint_t)1, bucketSeconds / timeStep);
+    uint_t numBuckets = 0;
+    if (endTS > beginTS)
+    {
+        numBuckets = ((endTS - beginTS) + bucketTS - 1) / bucketTS;
+        numBuckets = utl::min(numBuckets, maxBuckets);
+        endTS = utl::min(endTS, beginTS + (int)(numBuckets * bucketTS));
+    }
+    utl::serialize(numBuckets, socket, io_wr);
+    uint_t bucketWidth = bucketTS * timeStep;
+    utl::serialize(bucketWidth, socket, io_wr);
+
+    // per-bucket totals for one resource
+    std::vector<double> reqTime(numBuckets), prvTime(numBuckets), idleTime(numBuckets);
+    std::vector<double> utilization(numBuckets), idle(numBuckets);
+    uint_vector_t peak(numBuckets);
+
+    // write each resource's load
+    for (auto resIdObj : resIds)
+    {
+        if (!resIdObj->isA(Uint))
+        {
+            continue;
+        }
+        uint_t resId = utl::cast<Uint>(*resIdObj);
+        std::fill(reqTime.begin(), reqTime.end(), 0.0);
+        std::fill(prvTime.begin(), prvTime.end(), 0.0);
+        std::fill(idleTime.begin(), idleTime.end(), 0.0);
+        std::fill(peak.begin(), peak.end(), 0);
+
+        // accumulate required and provided capacity over the spans that overlap the window
+        auto cseRes = dataSet->findResource(resId);
+        if ((numBuckets > 0) && (cseRes != nullptr) && cseRes->isA(cse::DiscreteResource))
+        {
+            auto cseDres = utl::cast<cse::DiscreteResource>(cseRes);
+            auto clsDres = utl::cast<cls::DiscreteResource>(cseDres->clsResource());
+            auto& tt = clsDres->timetable();
+            auto tail = tt.tail();
+            auto span = tt.find(beginTS);
+            for (; (span != nullptr) && (span != tail) && (span->min() < endTS);
+                 span = span->next())
+            {
+                uint_t reqCap = span->v0();
+                uint_t prvCap = span->v1();
+                int t = utl::max(span->min(), beginTS);
+                int spanEnd = utl::min(span->max() + 1, endTS);
+                while (t < spanEnd)
+                {
+                    // the part of the span that's in this bucket
+                    uint_t bucket = (t - beginTS) / bucketTS;
+                    int bucketEnd = utl::min(spanEnd, beginTS + (int)((bucket + 1) * bucketTS));
+                    double len = bucketEnd - t;
+                    reqTime[bucket] += reqCap * len;
+                    prvTime[bucket] += prvCap * len;
+                    if ((reqCap == 0) && (prvCap > 0))
+                    {
+                        idleTime[bucket] += len;
+                    }
+                    peak[bucket] = utl::max(peak[bucket], reqCap);
+                    t = bucketEnd;
+                }
+            }
+        }
+
+        // utilization = required capacity-time / provided capacity-time
+        // idle = share of the bucket's time where capacity is provided but none is required
+        for (uint_t bucket = 0; bucket != numBuckets; ++bucket)
+        {
+            int bucketBegin = beginTS + (bucket * bucketTS);
+            double len = utl::min(endTS, bucketBegin + bucketTS) - bucketBegin;
+            double prv = prvTime[bucket];
+            utilization[bucket] = (prv == 0.0) ? 0.0 : (reqTime[bucket] / prv);
+            idle[bucket] = idleTime[bucket] / len;
+        }
+
+        // write resource id, then the three arrays
+        utl::serialize(resId, socket, io_wr);
+        for (auto val : utilization)
+        {
+            utl::serialize(val, socket, io_wr);
+        }
+        for (auto val : peak)
+        {
+            utl::serialize(val, socket, io_wr);
+        }
+        for (auto val : idle)
+        {
+            utl::serialize(val, socket, io_wr);
+        }
+    }
+
+    // end marker
+    uint_t endMarker = uint_t_max;
+    utl::serialize(endMarker, socket, io_wr);
+    finishCmd(client);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+Server::handle_getParetoFront(SEclient* client, const utl::Array& cmd)
+{
+    if (cmd.size() != 1)
+    {
+        clientDisconnect(client);
+        return;
+    }
+
+    // get a copy of the archive's scores (the run may still be in progress)
+    uint_t numObjectives = 0;
+    std::vector<double> scores;
+    auto optimizer = dynamic_cast<ParetoSA*>(client->run()->optimizer());
+    if ((optimizer != nullptr) && (optimizer->archive() != nullptr))
+    {
+        auto archive = optimizer->archive();
+        numObjectives = archive->numObjectives();
+        archive->getScores(scores);
+    }
+    uint_t numInds = (numObjectives == 0) ? 0 : (scores.size() / numObjectives);
+
+    // write the front
+    auto& socket = client->socket();
+    Uint(numInds).serializeOut(socket);
+    Uint(numObjectives).serializeOut(socket);
+    for (auto score : scores)
+    {
+        Float(score).serializeOut(socket);
+    }
+    finishCmd(client);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 Server::handle_NOP(SEclient* client, const utl::Array& cmd)
 {
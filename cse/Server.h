@@ -52,7 +52,8 @@ class SEclient;
 
    ---
 
-   Initialize a "simple" scheduling run to construct a forward schedule.
+   Initialize a "simple" scheduling run to construct a forward schedule.  The run's thread budget
+   is the server's (see Server::numThreads).
 
    Arguments:
 
@@ -104,7 +105,12 @@ class SEclient;
    If the client had previously issued an **initOptimizerRun** command, spawn a thread to execute
    the optimization run.
 
-   Arguments: none
+   An optimization run may be given a hard deadline: when it passes, the run completes (as
+   reported by **getRunStatus**) with the best schedule found by then.
+
+   Arguments:
+
+   - utl::Uint : deadline in milliseconds (optional)
 
    Response:
 
@@ -152,7 +158,11 @@ class SEclient;
 
    Provide the audit report for the schedule with the best score.
 
-   Arguments: none
+   Arguments (optional): utl::Uint (report sections to include, see cse::audit_section_t)
+
+   Report sections are collected when they're first requested, so a client that only needs some
+   of them should ask for those.  The report may also include sections that were collected for
+   earlier requests.
 
    Response: cse::AuditReport
 
@@ -206,6 +216,26 @@ class SEclient;
    - utl::Array of cse::ResourceRequirement%s
    - utl::Array of cse::ResourceGroupRequirement%s
 
+   ### exportBestSchedule
+
+   ---
+
+   Write the information provided by getBestSchedule as a columnar binary image (see
+   cse::ScheduleExport), so that large schedules needn't be serialized over the connection.  The
+   client can read (or mmap) the image in place.
+
+   Arguments: utl::String ("shm:/name" for the POSIX shared-memory object "/clevor_export.name",
+   or the name of a file in the server's export directory (see Server::setExportDir))
+
+   A name is letters, digits, '.', '_' and '-', and can't begin with '.' or contain "..".  Any
+   other target is rejected.  Files can only be written if the server has an export
+   directory.  The image is written completely before it replaces an existing target.
+
+   Response:
+
+   - utl::Bool (true if successful)
+   - utl::String (the target if successful, otherwise an error message)
+
    ### getMakespan
 
    ---
@@ -226,6 +256,54 @@ class SEclient;
 
    Response: Array of cse::TimeSlot%s specifying required and provided capacity over time
 
+   ### getTimetableLoad
+
+   ---
+
+   Provide the load of several cse::DiscreteResource%s over a time window, aggregated into
+   fixed-width buckets (e.g. for a plant-wide load view).  The aggregation is done over each
+   resource's timetable, so only the per-bucket values are sent.
+
+   Arguments:
+
+   - utl::Array of utl::Uint%s (cse::DiscreteResource ids)
+   - utl::Uint (window begin time as time_t)
+   - utl::Uint (window end time as time_t)
+   - utl::Uint (bucket width in seconds, rounded down to whole time-slots)
+
+   Response (values are written directly, not as objects):
+
+   - uint_t : count of buckets (at most 65536, the window is truncated to fit)
+   - uint_t : bucket width in seconds
+
+   Then, for each resource id that was given:
+
+   - uint_t : resource id
+   - double for each bucket : utilization (required / provided capacity-time)
+   - uint_t for each bucket : peak required capacity
+   - double for each bucket : idle fraction (share of the bucket where capacity is provided but
+     none is required)
+
+   The list of resources is terminated by utl::uint_t_max as a resource id.  An unknown resource
+   id has zero load.
+
+   ### getParetoFront
+
+   ---
+
+   Provide the archive of non-dominated schedules found by a gop::ParetoSA optimization run
+   (which may still be in progress).  For any other run, the archive is empty.
+
+   Arguments: none
+
+   Response:
+
+   - utl::Uint : count of schedules in the archive
+   - utl::Uint : count of objectives
+
+   Then, for each schedule, one utl::Float per objective (the schedule's score for that
+   objective, in the same order as the run's objectives).
+
    \ingroup cse
 */
 
@@ -251,6 +329,34 @@ public:
 
     virtual void* run(void* arg = nullptr);
 
+    /** Get the directory that exported schedules are written to (empty = shm:/ only). */
+    const std::string&
+    exportDir() const
+    {
+        return _exportDir;
+    }
+
+    /** Set the directory that exported schedules are written to (empty = shm:/ only). */
+    void
+    setExportDir(const std::string& exportDir)
+    {
+        _exportDir = exportDir;
+    }
+
+    /** Get the thread budget of a simple run. */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
+
+    /** Set the thread budget of a simple run. */
+    void
+    setNumThreads(uint_t numThreads)
+    {
+        _numThreads = utl::max(numThreads, (uint_t)1);
+    }
+
 protected:
     typedef void (Server::*hfn)(SEclient* client, const utl::Array& cmd);
     using handler_map_t = std::map<std::string, hfn>;
@@ -280,6 +386,8 @@ protected:
 
 protected:
     bool _recording;
+    std::string _exportDir;
+    uint_t _numThreads;
 
 private:
     void init(bool recording = false);
@@ -300,8 +408,11 @@ private:
     void handle_getBestScoreAuditReport(SEclient* client, const utl::Array& cmd);
     void handle_getBestScoreComponent(SEclient* client, const utl::Array& cmd);
     void handle_getBestSchedule(SEclient* client, const utl::Array& cmd);
+    void handle_exportBestSchedule(SEclient* client, const utl::Array& cmd);
     void handle_getMakespan(SEclient* client, const utl::Array& cmd);
     void handle_getTimetable(SEclient* client, const utl::Array& cmd);
+    void handle_getTimetableLoad(SEclient* client, const utl::Array& cmd);
+    void handle_getParetoFront(SEclient* client, const utl::Array& cmd);
     void handle_NOP(SEclient* client, const utl::Array& cmd);
     void handle_stop(SEclient* client, const utl::Array& cmd);
 
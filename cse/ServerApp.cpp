@@ -55,6 +55,25 @@ ServerApp::run(int argc, char** argv)
     // record commands?
     bool recording = args.isSet("r");
 
+    // directory for exported schedules?
+    String exportDir;
+    if (!args.isSet("x", exportDir))
+    {
+        exportDir = hostOS->getEnv("CSE_EXPORT_DIR");
+    }
+
+    // thread budget of a simple run?
+    uint_t numThreads = 1;
+    String numThreadsStr;
+    if (!args.isSet("t", numThreadsStr))
+    {
+        numThreadsStr = hostOS->getEnv("CSE_NUM_THREADS");
+    }
+    if (!numThreadsStr.empty())
+    {
+        numThreads = Uint(numThreadsStr);
+    }
+
     // incorrect/unknown arguments -> print usage and exit (status code 1)
     if (args.printErrors(utl::cerr))
     {
@@ -73,6 +92,8 @@ ServerApp::run(int argc, char** argv)
 
     // create the Server
     auto server = new Server(2, recording);
+    server->setExportDir(exportDir.get());
+    server->setNumThreads(numThreads);
     TCPserverSocket* serverSocket = nullptr;
 
     // add server socket for network interface
@@ -117,7 +138,8 @@ ServerApp::run(int argc, char** argv)
 void
 ServerApp::usage()
 {
-    utl::cout << "usage: clevor_se [-d] [-p <port>] [-r]" << endl;
+    utl::cout << "usage: clevor_se [-d] [-p <port>] [-r] [-t <num-threads>] [-x <export-dir>]"
+              << endl;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
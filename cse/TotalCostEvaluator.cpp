@@ -168,6 +168,58 @@ SpanInterestPeriod::copy(const Object& rhs)
     period = ip.period;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// TotalCostEvaluator::Workspace //////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TotalCostEvaluator::Workspace::Workspace()
+{
+    ipCosts = nullptr;
+    ipCostsSize = 0;
+    totalCost = 0.0;
+    dayIsBreak = nullptr;
+    dayIsBreakSize = 0;
+    caps = nullptr;
+    capsSize = 0;
+    capDayTimes = nullptr;
+    capDayTimesSize = 0;
+    capDayHires = nullptr;
+    capDayHiresSize = 0;
+    capDayFireBeforeHire = nullptr;
+    capDayFireBeforeHireSize = 0;
+    dayCosts = nullptr;
+    dayCostsSize = 0;
+    dayCostPeriods = nullptr;
+    dayCostPeriodsSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TotalCostEvaluator::Workspace::~Workspace()
+{
+    delete[] ipCosts;
+    delete[] dayIsBreak;
+    delete[] caps;
+    delete[] capDayTimes;
+    delete[] capDayHires;
+    delete[] capDayFireBeforeHire;
+    delete[] dayCosts;
+    delete[] dayCostPeriods;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TotalCostEvaluator::Workspace::clear(uint_t numIPs)
+{
+    utl::arrayGrow(ipCosts, ipCostsSize, utl::max(numIPs, (uint_t)1));
+    for (uint_t i = 0; i != numIPs; ++i)
+    {
+        ipCosts[i] = 0.0;
+    }
+    totalCost = 0.0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// TotalCostEvaluator /////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,44 +238,21 @@ TotalCostEvaluator::copy(const Object& rhs)
     _overheadCostPerTS = tce._overheadCostPerTS;
     _interestRate = tce._interestRate;
     _numIPs = tce._numIPs;
-
-    // create _ipCosts[]
-    delete[] _ipCosts;
-    _ipCosts = nullptr;
-    if (_numIPs > 0)
-    {
-        _ipCosts = new double[_numIPs];
-    }
+    _numThreads = tce._numThreads;
+    _auditSections = tce._auditSections;
 
     // copy _ipSpans
     _ipSpans = tce._ipSpans;
 
-    // everything else should be null or zero...
-
-    // _dayIsBreak
-    ASSERTD(_dayIsBreak == tce._dayIsBreak);
-    ASSERTD(_dayIsBreakSize == tce._dayIsBreakSize);
-    // _caps
-    ASSERTD(_caps == tce._caps);
-    ASSERTD(_capsSize == tce._capsSize);
-    // _capDayTimes
-    ASSERTD(_capDayTimes == tce._capDayTimes);
-    ASSERTD(_capDayTimesSize == tce._capDayTimesSize);
-    // _capDayHires
-    ASSERTD(_capDayHires == tce._capDayHires);
-    ASSERTD(_capDayHiresSize == tce._capDayHiresSize);
-    // _capDayFireBeforeHire
-    ASSERTD(_capDayFireBeforeHire == tce._capDayFireBeforeHire);
-    ASSERTD(_capDayFireBeforeHireSize == tce._capDayFireBeforeHireSize);
-    // _dayCosts
-    ASSERTD(_dayCosts == tce._dayCosts);
-    ASSERTD(_dayCostsSize == tce._dayCostsSize);
-    // _dayCostPeriods
-    ASSERTD(_dayCostPeriods == tce._dayCostPeriods);
-    ASSERTD(_dayCostPeriodsSize == tce._dayCostPeriodsSize);
-    // _auditReport
-    ASSERTD(_auditReport == tce._auditReport);
-    ASSERTD(_auditIpCosts.empty() && tce._auditIpCosts.empty());
+    // the thread pool and workspaces are made when they're first needed
+    delete _threadPool;
+    _threadPool = nullptr;
+    deleteCont(_workspaces);
+
+    // audit results aren't copied
+    delete _auditReport;
+    _auditReport = nullptr;
+    _auditIpCosts.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,29 +299,30 @@ TotalCostEvaluator::initialize(const IndEvaluatorConfiguration* p_cf)
     uint_t ts = _originTS;
     for (time_t t = originTime; t < horizonTime; t += _timeStep, ++ts)
     {
-        struct tm* tm = localtime(&t);
+        struct tm tms;
+        localtime_r(&t, &tms);
 
         // bump interest period (ip)
         switch (period)
         {
         case period_day:
-            if (tm->tm_mday != (int)lastIP)
+            if (tms.tm_mday != (int)lastIP)
             {
-                lastIP = tm->tm_mday;
+                lastIP = tms.tm_mday;
                 ++ip;
             }
             break;
         case period_week:
-            if ((tm->tm_wday != (int)lastIP) && (lastIP == 6))
+            if ((tms.tm_wday != (int)lastIP) && (lastIP == 6))
             {
                 ++ip;
             }
-            lastIP = tm->tm_wday;
+            lastIP = tms.tm_wday;
             break;
         case period_month:
-            if (tm->tm_mon != (int)lastIP)
+            if (tms.tm_mon != (int)lastIP)
             {
-                lastIP = tm->tm_mon;
+                lastIP = tms.tm_mon;
                 ++ip;
             }
             break;
@@ -320,10 +350,23 @@ TotalCostEvaluator::initialize(const IndEvaluatorConfiguration* p_cf)
         _ipSpans.add(new SpanInterestPeriod(spanBegin, spanEnd + 1, spanIP));
     }
 
-    // create _ipCosts[] (same size as _ipSpans)
+    // _numIPs = number of interest periods (ipCosts[] is sized on demand)
     _numIPs = _ipSpans.size();
-    delete[] _ipCosts;
-    _ipCosts = new double[_numIPs];
+
+    // number of threads
+    _numThreads = utl::max(cf.numThreads(), (uint_t)1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TotalCostEvaluator::setNumThreads(uint_t numThreads)
+{
+    // the thread pool and workspaces are re-created on first use
+    delete _threadPool;
+    _threadPool = nullptr;
+    deleteCont(_workspaces);
+    _numThreads = utl::max(numThreads, (uint_t)1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,17 +377,21 @@ TotalCostEvaluator::calcScore(const IndBuilderContext* p_context) const
     auto& context = utl::cast<SchedulingContext>(*p_context);
 
     // zero the cost vector
-    _totalCost = 0.0;
-    for (uint_t i = 0; i != _numIPs; ++i)
-    {
-        _ipCosts[i] = 0.0;
-    }
+    _ws.clear(_numIPs);
 
     // auditing -> create output stream & print general information to it
     //             create _auditReport
+    //             (text is only written if it was requested, otherwise it's discarded)
     if (_audit)
     {
-        _os = new std::ostringstream();
+        if ((_auditSections & audit_text) == 0)
+        {
+            _os = new std::ostream(nullptr);
+        }
+        else
+        {
+            _os = new std::ostringstream();
+        }
         *_os << heading("TotalCostEvaluator", '=', 80) << std::endl;
 
         time_t origTime = _schedulerConfig->originTime();
@@ -359,27 +406,31 @@ TotalCostEvaluator::calcScore(const IndBuilderContext* p_context) const
         *_os << "time-step: " << timeStep << " sec." << std::endl;
         delete _auditReport;
         _auditReport = new AuditReport();
+        _auditReport->useArena();
+        _auditReport->setSections(_auditSections);
         _auditReport->setName(this->name());
         _auditReport->setOriginTime(origTime);
         _auditReport->setHorizonTime(horiTime);
         _auditReport->setTimeStep(timeStep);
 
-        *_os << heading("Interest Periods", '-', 75) << std::endl;
-        spanip_col_t::iterator it;
-        uint_t ipIdx = 0;
-        for (auto sip_ : _ipSpans)
+        if (auditing(audit_periods))
         {
-            auto sip = utl::cast<SpanInterestPeriod>(sip_);
-            time_t begin = origTime + (sip->begin() * timeStep);
-            time_t end = origTime + (sip->end() * timeStep);
-            *_os << "i.p. " << ipIdx << ": "
-                 << "[" << time_str(begin) << "," << time_str(end) << ")" << std::endl;
-            auto info = new InterestPeriodInfo();
-            info->idx = ipIdx;
-            info->begin = begin;
-            info->end = end;
-            _auditReport->interestPeriods()->push_back(info);
-            ++ipIdx;
+            *_os << heading("Interest Periods", '-', 75) << std::endl;
+            uint_t ipIdx = 0;
+            for (auto sip_ : _ipSpans)
+            {
+                auto sip = utl::cast<SpanInterestPeriod>(sip_);
+                time_t begin = origTime + (sip->begin() * timeStep);
+                time_t end = origTime + (sip->end() * timeStep);
+                *_os << "i.p. " << ipIdx << ": "
+                     << "[" << time_str(begin) << "," << time_str(end) << ")" << std::endl;
+                auto info = _auditReport->create<InterestPeriodInfo>();
+                info->idx = ipIdx;
+                info->begin = begin;
+                info->end = end;
+                _auditReport->interestPeriods()->push_back(info);
+                ++ipIdx;
+            }
         }
     }
 
@@ -407,29 +458,89 @@ TotalCostEvaluator::calcScore(const IndBuilderContext* p_context) const
     // auditing?
     if (_audit)
     {
+        // _auditReport has an OperationInfo for each op (ops are in id order)
+        if (auditing(audit_jobs))
+        {
+            auto opInfos = _auditReport->operationInfos();
+            for (auto op : context.clevorDataSet()->ops())
+            {
+                auto info = _auditReport->create<OperationInfo>();
+                info->id = op->id();
+                info->name = op->name();
+                opInfos->insert(opInfos->end(), opInfos_t::value_type(info->id, info));
+            }
+        }
+
         // audit must be explicitly enabled
         _audit = false;
 
-        // _auditReport has an OperationInfo for each op
-        auto& ops = context.clevorDataSet()->ops();
-        for (auto op : ops)
+        // record audit text in _auditText, delete audit output stream
+        if ((_auditSections & audit_text) == 0)
         {
-            auto info = new OperationInfo();
-            info->id = op->id();
-            info->name = op->name();
-            _auditReport->operationInfos()->insert(opInfos_t::value_type(info->id, info));
+            _auditText.clear();
+        }
+        else
+        {
+            *_os << '\0';
+            _auditText = static_cast<std::ostringstream*>(_os)->str();
         }
-
-        // record audit text in _auditText, delete audit output stream
-        *_os << '\0';
-        _auditText = _os->str();
         delete _os;
+        _os = nullptr;
 
         // record the total cost in _auditReport
-        _auditReport->setScore(_totalCost);
+        _auditReport->setScore(_ws.totalCost);
+    }
+
+    return _ws.totalCost;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+TotalCostEvaluator::scoreLowerBound(const IndBuilderContext* p_context) const
+{
+    if (!_forward || (_interestRate != 0.0))
+    {
+        return -utl::double_t_max;
     }
+    auto& context = utl::cast<SchedulingContext>(*p_context);
 
-    return _totalCost;
+    // opportunity/lateness cost of each active job with a due time (for its earliest completion)
+    auto& ws = _ws;
+    ws.clear(_numIPs);
+    for (auto& jobHot : context.clevorDataSet()->jobsHot())
+    {
+        auto job = jobHot.job;
+        if (!jobHot.active || (job->dueTime() == -1))
+        {
+            continue;
+        }
+        int dueTime = context.timeToTimeSlot(job->dueTime());
+        int makespan = job->makespanLowerBound();
+        if ((makespan < dueTime) && (job->opportunityCostPeriod() != period_undefined))
+        {
+            // opportunity cost (negative)
+            double periodSeconds = (double)periodToSeconds(job->opportunityCostPeriod());
+            double opportunityCostPerTS = job->opportunityCost() / (periodSeconds / _timeStep);
+            if (opportunityCostPerTS > 0.0)
+            {
+                calcPeriodCost(ws, Span<int>(makespan, dueTime), -1.0 * opportunityCostPerTS);
+            }
+        }
+        else if ((makespan > dueTime) && (job->latenessCostPeriod() != period_undefined))
+        {
+            // lateness cost
+            double periodSeconds = (double)periodToSeconds(job->latenessCostPeriod());
+            double latenessCostPerTS = job->latenessCost() / (periodSeconds / _timeStep);
+            double latenessIncrement = 1.0 + (job->latenessIncrement() / 100);
+            if (latenessCostPerTS > 0.0)
+            {
+                calcPeriodCost(ws, Span<int>(dueTime, makespan), latenessCostPerTS,
+                               latenessIncrement, periodSeconds, (double)_timeStep);
+            }
+        }
+    }
+    return ws.totalCost;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -445,22 +556,9 @@ TotalCostEvaluator::init()
     _overheadCostPerTS = 0.0;
     _interestRate = 0.0;
     _numIPs = 0;
-    _totalCost = 0.0;
-    _ipCosts = nullptr;
-    _dayIsBreak = nullptr;
-    _dayIsBreakSize = 0;
-    _caps = nullptr;
-    _capsSize = 0;
-    _capDayTimes = nullptr;
-    _capDayTimesSize = 0;
-    _capDayHires = nullptr;
-    _capDayHiresSize = 0;
-    _capDayFireBeforeHire = nullptr;
-    _capDayFireBeforeHireSize = 0;
-    _dayCosts = nullptr;
-    _dayCostsSize = 0;
-    _dayCostPeriods = nullptr;
-    _dayCostPeriodsSize = 0;
+    _numThreads = 1;
+    _threadPool = nullptr;
+    _auditSections = audit_all;
     _auditReport = nullptr;
 }
 
@@ -469,26 +567,58 @@ TotalCostEvaluator::init()
 void
 TotalCostEvaluator::deInit()
 {
-    delete[] _ipCosts;
-    delete[] _dayIsBreak;
-    delete[] _caps;
-    delete[] _capDayTimes;
-    delete[] _capDayHires;
-    delete[] _capDayFireBeforeHire;
-    delete[] _dayCosts;
-    delete[] _dayCostPeriods;
+    delete _threadPool;
+    deleteCont(_workspaces);
     delete _auditReport;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+TotalCostEvaluator::runParallel(uint_t numTasks, const task_func_t& func) const
+{
+    ASSERTD(parallel());
+
+    // create thread pool and per-thread workspaces on first use
+    if (_threadPool == nullptr)
+    {
+        _threadPool = new ThreadPool(_numThreads);
+    }
+    while (_workspaces.size() < _numThreads)
+    {
+        _workspaces.push_back(new Workspace());
+    }
+    for (auto ws : _workspaces)
+    {
+        ws->clear(_numIPs);
+    }
+
+    // run the tasks
+    _threadPool->run(numTasks, [&](uint_t taskIdx, uint_t threadIdx) {
+        func(taskIdx, *_workspaces[threadIdx]);
+    });
+
+    // add per-thread costs to the totals (in thread order, so the result is repeatable)
+    for (auto ws : _workspaces)
+    {
+        for (uint_t ip = 0; ip != _numIPs; ++ip)
+        {
+            _ws.ipCosts[ip] += ws->ipCosts[ip];
+        }
+        _ws.totalCost += ws->totalCost;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 TotalCostEvaluator::calcResourceCost(const SchedulingContext& context) const
 {
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = _ws.totalCost;
     auto clsSchedule = context.schedule();
 
     // for each cls::Resource
+    _costedResources.clear();
     auto resourcesEnd = clsSchedule->resourcesEnd();
     for (auto rit = clsSchedule->resourcesBegin(); rit != resourcesEnd; ++rit)
     {
@@ -498,23 +628,32 @@ TotalCostEvaluator::calcResourceCost(const SchedulingContext& context) const
         {
             continue;
         }
+        _costedResources.push_back(utl::cast<cls::DiscreteResource>(res));
+    }
 
-        // calculate cost
-        const auto& dres = utl::cast<cls::DiscreteResource>(*res);
-        cslist_t cslist;
-        cslistBuild(context, dres, cslist);
-        cslistCost(context, dres, cslist);
-        deleteCont(cslist);
+    // calculate cost
+    if (parallel())
+    {
+        runParallel(_costedResources.size(), [&](uint_t idx, Workspace& ws) {
+            calcResourceCost(context, *_costedResources[idx], ws);
+        });
+    }
+    else
+    {
+        for (auto dres : _costedResources)
+        {
+            calcResourceCost(context, *dres, _ws);
+        }
     }
 
-    // increase in _totalCost is recorded as ResourceCost
-    double totalResourceCost = _totalCost - saveTotalCost;
+    // increase in total cost is recorded as ResourceCost
+    double totalResourceCost = _ws.totalCost - saveTotalCost;
     setComponentScore("ResourceCost", (int)totalResourceCost);
 
     // auditing -> record resource cost in _auditReport
     if (_audit)
     {
-        auto info = new ComponentScoreInfo();
+        auto info = _auditReport->create<ComponentScoreInfo>();
         info->name = "ResourceCost";
         info->score = totalResourceCost;
         _auditReport->componentInfos()->push_back(info);
@@ -523,6 +662,19 @@ TotalCostEvaluator::calcResourceCost(const SchedulingContext& context) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+TotalCostEvaluator::calcResourceCost(const SchedulingContext& context,
+                                     const cls::DiscreteResource& res,
+                                     Workspace& ws) const
+{
+    cslist_t cslist;
+    cslistBuild(context, res, cslist);
+    cslistCost(context, res, cslist, ws);
+    deleteCont(cslist);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // Note: resCost->resolution() is not considered, because cslistCost will round up
 //       .. a day's working time to hours anyway when hourly rate is given.
 //       We will need to change this code to accommodate resCost->resolution > 1 hr.
@@ -553,7 +705,7 @@ TotalCostEvaluator::cslistBuild(const SchedulingContext& context,
     }
 
     // auditing -> print this resource's ResourceCost info, record it in _auditReport
-    if (_audit)
+    if (auditing(audit_resources))
     {
         std::string title("calcResourceCost(id = ");
         uint_t resId = res.id();
@@ -581,7 +733,7 @@ TotalCostEvaluator::cslistBuild(const SchedulingContext& context,
         if (it == _auditReport->resourceInfos()->end())
         {
             // not found -> create it.
-            auto rcInfo = new ResourceInfo();
+            auto rcInfo = _auditReport->create<ResourceInfo>();
             rcInfo->id = resId;
             rcInfo->name = res.name();
             rcInfo->resolutionSlots = resolutionSlots;
@@ -796,7 +948,8 @@ TotalCostEvaluator::cslistDump(const cslist_t& cslist) const
 void
 TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                                const cls::DiscreteResource& res,
-                               const cslist_t& cslist) const
+                               const cslist_t& cslist,
+                               Workspace& ws) const
 {
 #ifdef DEBUG_UNIT
     std::string myName("TotalCostEvaluator::cslistCost(): ");
@@ -811,6 +964,9 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         return;
     }
 
+    // auditing -> this resource's ResourceCostReport (found once, when first needed)
+    ResourceCostReport* resReport = nullptr;
+
     // timeStep = seconds per time-slot
     // tsPerDay = time-slots per day
     uint_t timeStep = _schedulerConfig->timeStep();
@@ -841,12 +997,12 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
     // ccrs = per-capacity CapCostRecs
     // numCaps = number of unique required capacities
     //         = ccrs.size()
-    //         = _caps[] size
+    //         = ws.caps[] size
     //         >= 1 (we always have capacity 0)
     ccr_map_t ccrs;
     uint_t numCaps = 0;
-    utl::arrayGrow(_caps, _capsSize, 16);
-    _caps[numCaps++] = 0;
+    utl::arrayGrow(ws.caps, ws.capsSize, 16);
+    ws.caps[numCaps++] = 0;
     auto ccr = new CapCostRec(0);
     ccrs.insert(ccr_map_t::value_type(0, ccr));
 
@@ -867,8 +1023,8 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         if (it == ccrs.end())
         {
             // ccr = newly added CapCostRec for cap
-            utl::arrayGrow(_caps, _capsSize, numCaps + 1);
-            _caps[numCaps++] = cap;
+            utl::arrayGrow(ws.caps, ws.capsSize, numCaps + 1);
+            ws.caps[numCaps++] = cap;
             ccr = new CapCostRec(cap);
             ccr->startTime = roundDown(capSpan->begin, tsPerDay);
             ccrs.insert(ccr_map_t::value_type(cap, ccr));
@@ -883,11 +1039,11 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         ccr->endTime = roundUp(capSpan->end, tsPerDay);
 
         // auditing -> add ResourceUsageInfo for this CapSpan to _auditReport
-        if (_audit)
+        if (auditing(audit_resources))
         {
             uint_t timeStep = _schedulerConfig->timeStep();
             time_t origin = _schedulerConfig->originTime();
-            auto usage = new ResourceUsageInfo();
+            auto usage = _auditReport->create<ResourceUsageInfo>();
             usage->id = res.id();
             usage->cap = cap;
             usage->begin = origin + capSpan->begin * timeStep;
@@ -902,31 +1058,31 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
     uint_t existingCap = (uint_t)ceil((double)dres->existingCap() / 100.0);
     if ((ccrs.find(existingCap) == ccrs.end()) && (existingCap < maxCap))
     {
-        utl::arrayGrow(_caps, _capsSize, numCaps + 1);
-        _caps[numCaps++] = existingCap;
+        utl::arrayGrow(ws.caps, ws.capsSize, numCaps + 1);
+        ws.caps[numCaps++] = existingCap;
         ccr = new CapCostRec(existingCap);
         ccrs.insert(ccr_map_t::value_type(existingCap, ccr));
     }
 
     // index the required capacities
-    // .. sort _caps[]
-    // .. set capIdx for each CapCostRec to its location in _caps[]
-    std::sort(_caps, _caps + numCaps);
+    // .. sort ws.caps[]
+    // .. set capIdx for each CapCostRec to its location in ws.caps[]
+    std::sort(ws.caps, ws.caps + numCaps);
     for (uint_t capIdx = 0; capIdx != numCaps; ++capIdx)
     {
-        uint_t cap = _caps[capIdx];
+        uint_t cap = ws.caps[capIdx];
         auto it = ccrs.find(cap);
         ASSERTD(it != ccrs.end());
         auto ccr = (*it).second;
         ccr->capIdx = capIdx;
     }
-    ASSERTD(_caps[0] == 0);
+    ASSERTD(ws.caps[0] == 0);
 
     // CapCostRecs must eclipse higher capacity CapCostRecs
     int minStart = int_t_max, maxEnd = int_t_min;
     for (uint_t capIdx = numCaps - 1; capIdx != 0; --capIdx)
     {
-        uint_t cap = _caps[capIdx];
+        uint_t cap = ws.caps[capIdx];
         auto it = ccrs.find(cap);
         ASSERTD(it != ccrs.end());
         auto ccr = (*it).second;
@@ -938,17 +1094,17 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
 
     // grow the dayIsBreak[], capDayTimes[], capDayHires[] arrays
     uint_t cap_x_days = numCaps * numDays;
-    utl::arrayGrow(_dayIsBreak, _dayIsBreakSize, numDays);
-    utl::arrayGrow(_capDayTimes, _capDayTimesSize, cap_x_days);
-    utl::arrayGrow(_capDayHires, _capDayHiresSize, cap_x_days);
-    utl::arrayGrow(_capDayFireBeforeHire, _capDayFireBeforeHireSize, cap_x_days);
-    memset(_dayIsBreak, 1, numDays * sizeof(byte_t));
-    memset(_capDayTimes, 0, cap_x_days * sizeof(uint_t));
-    memset(_capDayHires, 0, cap_x_days * sizeof(uint_t));
-    memset(_capDayFireBeforeHire, 0, cap_x_days * sizeof(byte_t));
+    utl::arrayGrow(ws.dayIsBreak, ws.dayIsBreakSize, numDays);
+    utl::arrayGrow(ws.capDayTimes, ws.capDayTimesSize, cap_x_days);
+    utl::arrayGrow(ws.capDayHires, ws.capDayHiresSize, cap_x_days);
+    utl::arrayGrow(ws.capDayFireBeforeHire, ws.capDayFireBeforeHireSize, cap_x_days);
+    memset(ws.dayIsBreak, 1, numDays * sizeof(byte_t));
+    memset(ws.capDayTimes, 0, cap_x_days * sizeof(uint_t));
+    memset(ws.capDayHires, 0, cap_x_days * sizeof(uint_t));
+    memset(ws.capDayFireBeforeHire, 0, cap_x_days * sizeof(byte_t));
 
     // lastCap = existingCap
-    // lastCapIdx = index of existingCap (or next highest recorded capacity) within _caps[]
+    // lastCapIdx = index of existingCap (or next highest recorded capacity) within ws.caps[]
     uint_t lastCap = existingCap;
     uint_t lastCapIdx;
     {
@@ -987,7 +1143,7 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             for (uint_t ci = lastCapIdx + 1; ci <= capIdx; ++ci)
             {
                 int offset = (ci * numDays) + day;
-                ++_capDayHires[offset];
+                ++ws.capDayHires[offset];
             }
         }
         else if (cap < lastCap) // firing
@@ -995,9 +1151,9 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             for (uint_t ci = lastCapIdx; ci > capIdx; --ci)
             {
                 int offset = (ci * numDays) + day;
-                if (_capDayHires[offset] == 0)
+                if (ws.capDayHires[offset] == 0)
                 {
-                    _capDayFireBeforeHire[offset] = 1;
+                    ws.capDayFireBeforeHire[offset] = 1;
                 }
             }
         }
@@ -1020,33 +1176,33 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             }
 
             // day has non-break time...
-            _dayIsBreak[day] = 0;
+            ws.dayIsBreak[day] = 0;
 
-            // add workingTime to _capDayTimes for all capacities up to cap
+            // add workingTime to ws.capDayTimes for all capacities up to cap
             for (uint_t ci = 1; ci <= capIdx; ++ci)
             {
-                uint_t& wt = _capDayTimes[(ci * numDays) + day];
+                uint_t& wt = ws.capDayTimes[(ci * numDays) + day];
                 wt += workingTime;
             }
         }
     }
 
     // grow dayCosts[], dayCostPeriods[] arrays
-    utl::arrayGrow(_dayCosts, _dayCostsSize, numDays);
-    utl::arrayGrow(_dayCostPeriods, _dayCostPeriodsSize, numDays);
+    utl::arrayGrow(ws.dayCosts, ws.dayCostsSize, numDays);
+    utl::arrayGrow(ws.dayCostPeriods, ws.dayCostPeriodsSize, numDays);
 
     // cost each capacity
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = ws.totalCost;
     lastCap = 0;
     for (uint_t capIdx = 1; capIdx != numCaps; ++capIdx)
     {
         // find cap, capDiff
-        uint_t cap = _caps[capIdx];
+        uint_t cap = ws.caps[capIdx];
         uint_t capDiff = (cap - lastCap);
         lastCap = cap;
 
         // auditing -> print heading
-        if (_audit)
+        if (auditing(audit_resources))
         {
             char buf[128];
             sprintf(buf, "%u", cap);
@@ -1064,15 +1220,19 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         uint_t numCapDays = (ccr->endTime - ccr->startTime) / tsPerDay;
         ASSERTD(numCapDays != 0);
         uint_t capDayEnd = capDayBegin + numCapDays;
-        uint_t* ht = _capDayHires + (ccrCapIdx * numDays);
-        uint_t* wt = _capDayTimes + (ccrCapIdx * numDays);
-        byte_t* fbht = _capDayFireBeforeHire + (ccrCapIdx * numDays);
+        uint_t* ht = ws.capDayHires + (ccrCapIdx * numDays);
+        uint_t* wt = ws.capDayTimes + (ccrCapIdx * numDays);
+        byte_t* fbht = ws.capDayFireBeforeHire + (ccrCapIdx * numDays);
 
         // auditing -> print hours worked on each day
         //          -> add ResourceWorkHoursInfo to _auditReport
-        if (_audit)
+        if (auditing(audit_resources))
         {
-            auto& report = _auditReport->resourceCost(res.id());
+            if (resReport == nullptr)
+            {
+                resReport = &_auditReport->resourceCost(res.id());
+            }
+            auto& report = *resReport;
             uint_t curTs = capDayBegin * tsPerDay;
             *_os << "Hours worked on each day: ";
             for (uint_t day = capDayBegin; day < capDayEnd; ++day)
@@ -1081,7 +1241,7 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                 *_os << day << ":" << hoursWorked << " ";
                 time_t originTime = _schedulerConfig->originTime();
                 time_t curTime = originTime + (curTs * timeStep);
-                auto newInfo = new ResourceWorkHoursInfo();
+                auto newInfo = _auditReport->create<ResourceWorkHoursInfo>();
                 newInfo->cap = cap;
                 newInfo->date = curTime;
                 newInfo->minutes = wt[day] * capDiff * timeStep / 60;
@@ -1112,13 +1272,13 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         uint_t day;
         for (day = capDayBegin; day != capDayEnd; ++day)
         {
-            _dayCosts[day] = 0.0;
-            _dayCostPeriods[day] = period_undefined;
+            ws.dayCosts[day] = 0.0;
+            ws.dayCostPeriods[day] = period_undefined;
 
             uint_t workingTime = wt[day];
 
             // ignore day that is a break or has no working time
-            if (_dayIsBreak[day] || (workingTime == 0))
+            if (ws.dayIsBreak[day] || (workingTime == 0))
             {
                 continue;
             }
@@ -1131,8 +1291,8 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                 double cost = workingHours * hourCost;
                 // for hourly costs, all hiring has to be accounted for.
                 cost += ht[day] * hiringCost;
-                _dayCosts[day] = cost;
-                _dayCostPeriods[day] = period_hour;
+                ws.dayCosts[day] = cost;
+                ws.dayCostPeriods[day] = period_hour;
             }
 
             // daily cost?
@@ -1144,19 +1304,19 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                 {
                     cost += hiringCost;
                 }
-                if ((cost < _dayCosts[day]) || (_dayCostPeriods[day] == period_undefined))
+                if ((cost < ws.dayCosts[day]) || (ws.dayCostPeriods[day] == period_undefined))
                 {
-                    _dayCosts[day] = cost;
-                    _dayCostPeriods[day] = period_day;
+                    ws.dayCosts[day] = cost;
+                    ws.dayCostPeriods[day] = period_day;
                 }
             }
         }
 
-        // dayCosts = copy of _dayCosts
+        // dayCosts = copy of ws.dayCosts
         double* dayCosts = new double[numDays];
         for (uint_t i = 0; i < numDays; i++)
         {
-            dayCosts[i] = _dayCosts[i];
+            dayCosts[i] = ws.dayCosts[i];
         }
 
         // consider use of weekly rate
@@ -1169,14 +1329,14 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
 
             while (beginDay < capDayEnd)
             {
-                if ((!_dayIsBreak[beginDay]) && (wt[beginDay] != 0))
+                if ((!ws.dayIsBreak[beginDay]) && (wt[beginDay] != 0))
                 {
                     // determine the cost of the next 7 or less days
                     double next7DaysCost = 0.0;
                     uint_t lim = utl::min(beginDayPlus7, capDayEnd);
                     for (endDay = beginDay; endDay < lim; ++endDay)
                     {
-                        next7DaysCost += _dayCosts[endDay];
+                        next7DaysCost += ws.dayCosts[endDay];
                     }
                     // determine the cost for using weekly cost
                     double cost = weekCost;
@@ -1185,10 +1345,11 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                         cost += hiringCost;
                     }
                     // compare the costs
-                    if (((cost < next7DaysCost) || (_dayCostPeriods[beginDay] == period_undefined)))
+                    if (((cost < next7DaysCost) ||
+                         (ws.dayCostPeriods[beginDay] == period_undefined)))
                     {
-                        _dayCosts[beginDay] = cost;
-                        _dayCostPeriods[beginDay] = period_week;
+                        ws.dayCosts[beginDay] = cost;
+                        ws.dayCostPeriods[beginDay] = period_week;
                     }
                 }
                 // tomorrow is another day
@@ -1205,21 +1366,22 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             time_t originTime = _schedulerConfig->originTime();
             time_t t;
             t = originTime + (beginDay * tsPerDay * timeStep);
-            struct tm* tm = localtime(&t);
-            ++tm->tm_mon;
-            t = mktime(tm);
+            struct tm tms;
+            localtime_r(&t, &tms);
+            ++tms.tm_mon;
+            t = mktime(&tms);
             uint_t beginPlus30 = (t - originTime) / (tsPerDay * timeStep);
             uint_t endDay;
 
             while (beginDay < capDayEnd)
             {
-                if ((_dayIsBreak[beginDay]) || (wt[beginDay] == 0))
+                if ((ws.dayIsBreak[beginDay]) || (wt[beginDay] == 0))
                 {
                     ++beginDay;
                     t = originTime + (beginDay * tsPerDay * timeStep);
-                    tm = localtime(&t);
-                    ++tm->tm_mon;
-                    t = mktime(tm);
+                    localtime_r(&t, &tms);
+                    ++tms.tm_mon;
+                    t = mktime(&tms);
                     beginPlus30 = (t - originTime) / (tsPerDay * timeStep);
                     continue;
                 }
@@ -1230,8 +1392,8 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                 endDay = beginDay;
                 while (endDay < lim)
                 {
-                    next30DaysCost += _dayCosts[endDay];
-                    if (_dayCostPeriods[endDay] == period_week)
+                    next30DaysCost += ws.dayCosts[endDay];
+                    if (ws.dayCostPeriods[endDay] == period_week)
                     {
                         // handle the case where the end point for
                         // a weekly rate exceeds the month boundary.
@@ -1258,10 +1420,10 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
 
                 // compare the costs
                 if ((totalMonthCost < next30DaysCost) ||
-                    (_dayCostPeriods[beginDay] == period_undefined))
+                    (ws.dayCostPeriods[beginDay] == period_undefined))
                 {
-                    _dayCosts[beginDay] = cost;
-                    _dayCostPeriods[beginDay] = period_month;
+                    ws.dayCosts[beginDay] = cost;
+                    ws.dayCostPeriods[beginDay] = period_month;
                     beginDay = beginPlus30;
                 }
                 else
@@ -1270,9 +1432,9 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                 }
 
                 t = originTime + (beginDay * tsPerDay * timeStep);
-                tm = localtime(&t);
-                ++tm->tm_mon;
-                t = mktime(tm);
+                localtime_r(&t, &tms);
+                ++tms.tm_mon;
+                t = mktime(&tms);
                 beginPlus30 = (t - originTime) / (tsPerDay * timeStep);
             }
         }
@@ -1286,7 +1448,7 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         {
             // did not cost the day?
             // (no working time or the day is a break)
-            if (_dayCostPeriods[day] == period_undefined)
+            if (ws.dayCostPeriods[day] == period_undefined)
             {
                 ++day;
                 t += tsPerDay;
@@ -1299,14 +1461,18 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             auto sip = utl::cast<SpanInterestPeriod>(*it);
             uint_t ip = sip->period;
 
-            if (_audit)
+            if (auditing(audit_resources))
             {
                 time_t originTime = _schedulerConfig->originTime();
                 time_t curTime = originTime + (t * timeStep);
                 *_os << "Day: " << day << ": " << time_str(curTime) << std::endl;
 
-                auto& report = _auditReport->resourceCost(res.id());
-                auto newCost = new ResourceCostInfo();
+                if (resReport == nullptr)
+                {
+                    resReport = &_auditReport->resourceCost(res.id());
+                }
+                auto& report = *resReport;
+                auto newCost = _auditReport->create<ResourceCostInfo>();
                 newCost->cap = cap;
                 newCost->date = curTime;
                 newCost->hiredCap = 0;
@@ -1316,8 +1482,8 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             }
 
             // get cost & period
-            double cost = _dayCosts[day];
-            period_t period = (period_t)_dayCostPeriods[day];
+            double cost = ws.dayCosts[day];
+            period_t period = (period_t)ws.dayCostPeriods[day];
             // Determine the cost components.
             double rateCost = 0;
             uint_t capHired = 0;
@@ -1354,28 +1520,28 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
             // need to (re-)hire?
             if (capHired > 0)
             {
-                if (_audit)
+                if (auditing(audit_resources))
                 {
                     *_os << "Hiring " << capHired << " unit(s): "
                          << "$" << hireCost << std::endl;
-                    *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
+                    *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
 
-                    auto costInfo = _auditReport->resourceCost(res.id()).costs()->back();
+                    auto costInfo = resReport->costs()->back();
                     costInfo->hiredCap = capHired;
                     costInfo->hireCost = hireCost;
                 }
-                _ipCosts[ip] += hireCost;
-                _totalCost += hireCost;
-                if (_audit)
+                ws.ipCosts[ip] += hireCost;
+                ws.totalCost += hireCost;
+                if (auditing(audit_resources))
                 {
-                    *_os << " + $" << hireCost << " = $" << _ipCosts[ip] << std::endl;
+                    *_os << " + $" << hireCost << " = $" << ws.ipCosts[ip] << std::endl;
                 }
             }
 
             // auditing -> print the chosen rate
-            if (_audit)
+            if (auditing(audit_resources))
             {
-                *_os << "bestRate: " << periodToString((period_t)_dayCostPeriods[day])
+                *_os << "bestRate: " << periodToString((period_t)ws.dayCostPeriods[day])
                      << ", cost: $" << rateCost;
                 if ((period == period_hour) || (period == period_day))
                 {
@@ -1383,8 +1549,8 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                     *_os << ", hoursWorked: " << hoursWorked;
                 }
                 *_os << std::endl;
-                auto costInfo = _auditReport->resourceCost(res.id()).costs()->back();
-                costInfo->bestRate = (period_t)_dayCostPeriods[day];
+                auto costInfo = resReport->costs()->back();
+                costInfo->bestRate = (period_t)ws.dayCostPeriods[day];
                 costInfo->workCost = rateCost;
             }
 
@@ -1405,9 +1571,10 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
                 // HOWARD'S CHANGE.
                 // Slightly more complicated.
                 time_t tTime_T = _schedulerConfig->originTime() + (t * timeStep);
-                struct tm* tm = localtime(&tTime_T);
-                ++tm->tm_mon;
-                time_t nextMonth = mktime(tm);
+                struct tm tms;
+                localtime_r(&tTime_T, &tms);
+                ++tms.tm_mon;
+                time_t nextMonth = mktime(&tms);
                 // no need for rounding since everything is on day boundary
                 periodDays = (uint_t)difftime(nextMonth, tTime_T) / daySec;
             }
@@ -1419,21 +1586,21 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
 
             if (periodDays == 1)
             {
-                if (_audit)
+                if (auditing(audit_resources))
                 {
-                    *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
+                    *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
                 }
-                _ipCosts[ip] += rateCost;
-                _totalCost += rateCost;
-                if (_audit)
+                ws.ipCosts[ip] += rateCost;
+                ws.totalCost += rateCost;
+                if (auditing(audit_resources))
                 {
-                    *_os << " + $" << rateCost << " = $" << _ipCosts[ip] << std::endl;
+                    *_os << " + $" << rateCost << " = $" << ws.ipCosts[ip] << std::endl;
                 }
             }
             else
             {
                 double costPerTS = (double)rateCost / (double)(nextT - t);
-                calcPeriodCost(Span<int>(t, nextT), costPerTS);
+                calcPeriodCost(ws, Span<int>(t, nextT), costPerTS);
             }
 
             day += periodDays;
@@ -1441,8 +1608,8 @@ TotalCostEvaluator::cslistCost(const SchedulingContext& context,
         }
     }
 
-    // assess resource cost as the addition to _totalCost that happened here
-    double totalResCost = _totalCost - saveTotalCost;
+    // assess resource cost as the addition to ws.totalCost that happened here
+    double totalResCost = ws.totalCost - saveTotalCost;
     resCost->cost() = (uint_t)totalResCost;
 
     // clean up CapCostRecs
@@ -1459,199 +1626,233 @@ void
 TotalCostEvaluator::calcLatenessCost(const SchedulingContext& context) const
 {
     // auditing -> print header
-    if (_audit)
+    if (auditing(audit_jobs))
     {
         *_os << heading("calcOpportunity/Inventory/LatenessCost()", '-', 75) << std::endl;
     }
 
+    // find jobs that have a due time and are active
+    _jobs.clear();
+    for (auto& jobHot : context.clevorDataSet()->jobsHot())
+    {
+        auto job = jobHot.job;
+        if (!jobHot.active || (job->dueTime() == -1))
+        {
+            continue;
+        }
+        _jobs.push_back(job);
+    }
+
+    // _jobCosts[3 * idx + (0,1,2)] = opportunity/inventory/lateness cost for _jobs[idx]
+    uint_t numJobs = _jobs.size();
+    _jobCosts.assign(3 * numJobs, 0.0);
+    if (parallel())
+    {
+        runParallel(numJobs, [&](uint_t idx, Workspace& ws) {
+            calcLatenessCost(context, _jobs[idx], ws, &_jobCosts[3 * idx]);
+        });
+    }
+    else
+    {
+        for (uint_t idx = 0; idx != numJobs; ++idx)
+        {
+            calcLatenessCost(context, _jobs[idx], _ws, &_jobCosts[3 * idx]);
+        }
+    }
+
+    // total each kind of cost
     double oppCost = 0.0;
     double invCost = 0.0;
     double latCost = 0.0;
-    double saveTotalCost = _totalCost;
+    for (uint_t idx = 0; idx != numJobs; ++idx)
+    {
+        oppCost += _jobCosts[3 * idx];
+        invCost += _jobCosts[3 * idx + 1];
+        latCost += _jobCosts[3 * idx + 2];
+    }
 
-    // for each Job
-    auto& jobs = context.clevorDataSet()->jobs();
-    for (auto job : jobs)
+    setComponentScore("OpportunityCost", (int)oppCost);
+    setComponentScore("InventoryCost", (int)invCost);
+    setComponentScore("LatenessCost", (int)latCost);
+    if (_audit)
     {
-        // job has no due time or is inactive -> skip it
-        if (job->dueTime() == -1 || !job->active())
-        {
-            continue;
-        }
+        auto info1 = _auditReport->create<ComponentScoreInfo>();
+        info1->name = "OpportunityCost";
+        info1->score = oppCost;
+        _auditReport->componentInfos()->push_back(info1);
+        auto info2 = _auditReport->create<ComponentScoreInfo>();
+        info2->name = "InventoryCost";
+        info2->score = invCost;
+        _auditReport->componentInfos()->push_back(info2);
+        auto info3 = _auditReport->create<ComponentScoreInfo>();
+        info3->name = "LatenessCost";
+        info3->score = latCost;
+        _auditReport->componentInfos()->push_back(info3);
+    }
+}
 
-        // note job's due time and completion time
-        int dueTime = context.timeToTimeSlot(job->dueTime());
-        int makespan = job->makespan();
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TotalCostEvaluator::calcLatenessCost(const SchedulingContext& context,
+                                     const Job* job,
+                                     Workspace& ws,
+                                     double* costs) const
+{
+    double saveTotalCost = ws.totalCost;
+
+    // note job's due time and completion time
+    int dueTime = context.timeToTimeSlot(job->dueTime());
+    int makespan = job->makespan();
 
-        // DEBUG build: warn about discrepancy between job's makespan and latest op end time
+    // DEBUG build: warn about discrepancy between job's makespan and latest op end time
 #ifdef DEBUG
-        // check the makespan
-        int maxEndTime = -1;
-        for (auto op : *job)
+    // check the makespan
+    int maxEndTime = -1;
+    for (auto op : *job)
+    {
+        auto act = op->activity();
+        if ((op->type() == op_summary) || op->ignorable() || (act == nullptr))
         {
-            auto act = op->activity();
-            if ((op->type() == op_summary) || op->ignorable() || (act == nullptr))
-            {
-                continue;
-            }
-
-            int endTime = _schedulerConfig->forward() ? act->ef() + 1 : act->lf() + 1;
-            if (endTime > maxEndTime)
-            {
-                maxEndTime = endTime;
-            }
+            continue;
         }
 
-        // job has schedulable ops and makespan doesn't match latest op end time?
-        if ((maxEndTime != -1) && (makespan != maxEndTime))
+        int endTime = _schedulerConfig->forward() ? act->ef() + 1 : act->lf() + 1;
+        if (endTime > maxEndTime)
         {
-            // print warning
-            std::cout << "end times differ for job " << job->id() << " makespan " << makespan
-                      << " jobOp end time " << maxEndTime << std::endl;
+            maxEndTime = endTime;
         }
+    }
+
+    // job has schedulable ops and makespan doesn't match latest op end time?
+    if ((maxEndTime != -1) && (makespan != maxEndTime))
+    {
+        // print warning
+        std::cout << "end times differ for job " << job->id() << " makespan " << makespan
+                  << " jobOp end time " << maxEndTime << std::endl;
+    }
 #endif
 
-        // job ends exactly at due time -> no cost adjustment
-        if (dueTime == makespan)
-        {
-            continue;
-        }
+    // job ends exactly at due time -> no cost adjustment
+    if (dueTime == makespan)
+    {
+        return;
+    }
 
-        // opportunityCostPerTS = opportunity cost per time slot
-        double opportunityCostPerTS = 0.0;
-        if (job->opportunityCostPeriod() != period_undefined)
-        {
-            uint_t periodSeconds;
-            periodSeconds = periodToSeconds(job->opportunityCostPeriod());
-            opportunityCostPerTS =
-                job->opportunityCost() / ((double)periodSeconds / (double)_timeStep);
-        }
+    // opportunityCostPerTS = opportunity cost per time slot
+    double opportunityCostPerTS = 0.0;
+    if (job->opportunityCostPeriod() != period_undefined)
+    {
+        uint_t periodSeconds;
+        periodSeconds = periodToSeconds(job->opportunityCostPeriod());
+        opportunityCostPerTS = job->opportunityCost() / ((double)periodSeconds / (double)_timeStep);
+    }
 
-        // latenessCostPerTS = lateness cost per time slot
-        double latenessCostPerTS = 0.0;
-        double latenessIncrement = 0.0;
-        double latenessPeriodSeconds = 0.0;
-        if (job->latenessCostPeriod() != period_undefined)
-        {
-            latenessPeriodSeconds = (double)periodToSeconds(job->latenessCostPeriod());
-            latenessCostPerTS = job->latenessCost() / (latenessPeriodSeconds / (double)_timeStep);
-            latenessIncrement = job->latenessIncrement() / 100;
-            latenessIncrement += 1.0;
-        }
+    // latenessCostPerTS = lateness cost per time slot
+    double latenessCostPerTS = 0.0;
+    double latenessIncrement = 0.0;
+    double latenessPeriodSeconds = 0.0;
+    if (job->latenessCostPeriod() != period_undefined)
+    {
+        latenessPeriodSeconds = (double)periodToSeconds(job->latenessCostPeriod());
+        latenessCostPerTS = job->latenessCost() / (latenessPeriodSeconds / (double)_timeStep);
+        latenessIncrement = job->latenessIncrement() / 100;
+        latenessIncrement += 1.0;
+    }
 
-        // inventoryCostPerTS
-        double inventoryCostPerTS = 0.0;
-        if (job->inventoryCostPeriod() != period_undefined)
-        {
-            uint_t periodSeconds = periodToSeconds(job->inventoryCostPeriod());
-            inventoryCostPerTS = job->inventoryCost() / ((double)periodSeconds / (double)_timeStep);
-        }
+    // inventoryCostPerTS
+    double inventoryCostPerTS = 0.0;
+    if (job->inventoryCostPeriod() != period_undefined)
+    {
+        uint_t periodSeconds = periodToSeconds(job->inventoryCostPeriod());
+        inventoryCostPerTS = job->inventoryCost() / ((double)periodSeconds / (double)_timeStep);
+    }
 
-        if (_audit)
+    if (auditing(audit_jobs))
+    {
+        *_os << "WorkOrder id = " << job->id() << " name = " << job->name() << ": ";
+    }
+    if (makespan < dueTime)
+    {
+        // opportunity cost
+        if (auditing(audit_jobs))
         {
-            *_os << "WorkOrder id = " << job->id() << " name = " << job->name() << ": ";
+            *_os << "Opportunity Cost" << std::endl;
         }
-        if (makespan < dueTime)
+        calcPeriodCost(ws, Span<int>(makespan, dueTime), -1.0 * opportunityCostPerTS);
+        if (auditing(audit_jobs))
         {
-            // opportunity cost
-            if (_audit)
+            auto& report = _auditReport->latenessCost(job->id());
+            if (report.getName().empty())
             {
-                *_os << "Opportunity Cost" << std::endl;
+                report.setName(job->name());
             }
-            calcPeriodCost(Span<int>(makespan, dueTime), -1.0 * opportunityCostPerTS);
-            if (_audit)
+            for (auto& ipCost : _auditIpCosts)
             {
-                auto& report = _auditReport->latenessCost(job->id());
-                if (report.getName().empty())
-                {
-                    report.setName(job->name());
-                }
-                for (auto& ipCost : _auditIpCosts)
-                {
-                    auto info = new LatenessCostInfo();
-                    info->interestPeriod = ipCost.first;
-                    info->opportunityCost = ipCost.second;
-                    info->latenessCost = 0;
-                    info->inventoryCost = 0;
-                    report.costs()->push_back(info);
-                }
+                auto info = _auditReport->create<LatenessCostInfo>();
+                info->interestPeriod = ipCost.first;
+                info->opportunityCost = ipCost.second;
+                info->latenessCost = 0;
+                info->inventoryCost = 0;
+                report.costs()->push_back(info);
             }
-            oppCost += _totalCost - saveTotalCost;
-            saveTotalCost = _totalCost;
+        }
+        costs[0] += ws.totalCost - saveTotalCost;
+        saveTotalCost = ws.totalCost;
 
-            // inventory cost
-            if (_audit)
+        // inventory cost
+        if (auditing(audit_jobs))
+        {
+            *_os << "Inventory Cost" << std::endl;
+        }
+        calcPeriodCost(ws, Span<int>(makespan, dueTime), inventoryCostPerTS);
+        if (auditing(audit_jobs))
+        {
+            auto& report = _auditReport->latenessCost(job->id());
+            if (report.getName().empty())
             {
-                *_os << "Inventory Cost" << std::endl;
+                report.setName(job->name());
             }
-            calcPeriodCost(Span<int>(makespan, dueTime), inventoryCostPerTS);
-            if (_audit)
+            for (auto& ipCost : _auditIpCosts)
             {
-                auto& report = _auditReport->latenessCost(job->id());
-                if (report.getName().empty())
-                {
-                    report.setName(job->name());
-                }
-                for (auto& ipCost : _auditIpCosts)
-                {
-                    auto info = new LatenessCostInfo();
-                    info->interestPeriod = ipCost.first;
-                    info->opportunityCost = 0;
-                    info->latenessCost = 0;
-                    info->inventoryCost = ipCost.second;
-                    report.costs()->push_back(info);
-                }
+                auto info = _auditReport->create<LatenessCostInfo>();
+                info->interestPeriod = ipCost.first;
+                info->opportunityCost = 0;
+                info->latenessCost = 0;
+                info->inventoryCost = ipCost.second;
+                report.costs()->push_back(info);
             }
-            invCost += _totalCost - saveTotalCost;
-            saveTotalCost = _totalCost;
         }
-        else if (makespan > dueTime) // lateness cost
+        costs[1] += ws.totalCost - saveTotalCost;
+        saveTotalCost = ws.totalCost;
+    }
+    else if (makespan > dueTime) // lateness cost
+    {
+        if (auditing(audit_jobs))
+        {
+            *_os << "Lateness Cost" << std::endl;
+        }
+        calcPeriodCost(ws, Span<int>(dueTime, makespan), latenessCostPerTS, latenessIncrement,
+                       latenessPeriodSeconds, (double)_timeStep);
+        if (auditing(audit_jobs))
         {
-            if (_audit)
+            auto& report = _auditReport->latenessCost(job->id());
+            if (report.getName().empty())
             {
-                *_os << "Lateness Cost" << std::endl;
+                report.setName(job->name());
             }
-            calcPeriodCost(Span<int>(dueTime, makespan), latenessCostPerTS, latenessIncrement,
-                           latenessPeriodSeconds, (double)_timeStep);
-            if (_audit)
+            for (auto& ipCost : _auditIpCosts)
             {
-                auto& report = _auditReport->latenessCost(job->id());
-                if (report.getName().empty())
-                {
-                    report.setName(job->name());
-                }
-                for (auto& ipCost : _auditIpCosts)
-                {
-                    auto info = new LatenessCostInfo();
-                    info->interestPeriod = ipCost.first;
-                    info->opportunityCost = 0;
-                    info->latenessCost = ipCost.second;
-                    info->inventoryCost = 0;
-                    report.costs()->push_back(info);
-                }
+                auto info = _auditReport->create<LatenessCostInfo>();
+                info->interestPeriod = ipCost.first;
+                info->opportunityCost = 0;
+                info->latenessCost = ipCost.second;
+                info->inventoryCost = 0;
+                report.costs()->push_back(info);
             }
-            latCost += _totalCost - saveTotalCost;
-            saveTotalCost = _totalCost;
         }
-    }
-
-    setComponentScore("OpportunityCost", (int)oppCost);
-    setComponentScore("InventoryCost", (int)invCost);
-    setComponentScore("LatenessCost", (int)latCost);
-    if (_audit)
-    {
-        auto info1 = new ComponentScoreInfo();
-        info1->name = "OpportunityCost";
-        info1->score = oppCost;
-        _auditReport->componentInfos()->push_back(info1);
-        auto info2 = new ComponentScoreInfo();
-        info2->name = "InventoryCost";
-        info2->score = invCost;
-        _auditReport->componentInfos()->push_back(info2);
-        auto info3 = new ComponentScoreInfo();
-        info3->name = "LatenessCost";
-        info3->score = latCost;
-        _auditReport->componentInfos()->push_back(info3);
+        costs[2] += ws.totalCost - saveTotalCost;
+        saveTotalCost = ws.totalCost;
     }
 }
 
@@ -1661,92 +1862,121 @@ void
 TotalCostEvaluator::calcJobOverheadCost(const SchedulingContext& context) const
 {
     // auditing -> print header
-    if (_audit)
+    if (auditing(audit_jobs))
     {
         *_os << heading("calcJobOverheadCost()", '-', 75) << std::endl;
         _auditIpCosts.clear();
     }
 
-    double saveTotalCost = _totalCost;
-    double jobOverheadCost = 0.0;
-
-    // iterate over jobs
-    for (auto job : context.clevorDataSet()->jobs())
+    // find jobs that have a due time and are active
+    _jobs.clear();
+    for (auto& jobHot : context.clevorDataSet()->jobsHot())
     {
-        // skip a job that has no due time or is not active
-        if ((job->dueTime() == -1) || !job->active())
+        auto job = jobHot.job;
+        if (!jobHot.active || (job->dueTime() == -1))
         {
             continue;
         }
+        _jobs.push_back(job);
+    }
 
-        // makespan = job's makespan
-        // minStartTime = earliest start time of job's ops
-        int makespan = job->makespan();
-        int minStartTime = int_t_max;
-        for (auto op : *job)
+    // _jobCosts[idx] = overhead cost for _jobs[idx]
+    uint_t numJobs = _jobs.size();
+    _jobCosts.assign(numJobs, 0.0);
+    if (parallel())
+    {
+        runParallel(numJobs, [&](uint_t idx, Workspace& ws) {
+            calcJobOverheadCost(_jobs[idx], ws, _jobCosts[idx]);
+        });
+    }
+    else
+    {
+        for (uint_t idx = 0; idx != numJobs; ++idx)
         {
-            // skip summary, ignorable, and activity-less op
-            auto act = op->activity();
-            if ((op->type() == op_summary) || op->ignorable() || (act == nullptr))
-            {
-                continue;
-            }
-
-            // update minStartTime
-            minStartTime = min(minStartTime, act->es() + 1);
+            calcJobOverheadCost(_jobs[idx], _ws, _jobCosts[idx]);
         }
+    }
 
-        // overheadCostPerTS = overhead cost per time slot
-        double overheadCostPerTS = 0.0;
-        if (job->overheadCostPeriod() != period_undefined)
-        {
-            auto periodSeconds = periodToSeconds(job->overheadCostPeriod());
-            overheadCostPerTS = job->overheadCost() / ((double)periodSeconds / (double)_timeStep);
-        }
+    // total job overhead cost
+    double jobOverheadCost = 0.0;
+    for (auto cost : _jobCosts)
+    {
+        jobOverheadCost += cost;
+    }
 
-        // auditing -> print subheading for this Job
-        if (_audit)
-        {
-            *_os << "WorkOrder id = " << job->id() << " name = " << job->name() << ": "
-                 << "Job Overhead Cost" << std::endl;
-        }
+    setComponentScore("JobOverheadCost", (int)jobOverheadCost);
+    if (_audit)
+    {
+        *_os << "Total Job Overhead Cost: $" << jobOverheadCost << std::endl;
+        auto info = _auditReport->create<ComponentScoreInfo>();
+        info->name = "JobOverheadCost";
+        info->score = jobOverheadCost;
+        _auditReport->componentInfos()->push_back(info);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // calculate interest period costs for this job
-        calcPeriodCost(Span<int>(minStartTime, makespan), overheadCostPerTS);
+void
+TotalCostEvaluator::calcJobOverheadCost(const Job* job, Workspace& ws, double& cost) const
+{
+    double saveTotalCost = ws.totalCost;
 
-        // auditing -> record job's overhead cost in its JobOverheadCostReport
-        //             (with a JobOverheadCostInfo for each interest period)
-        if (_audit)
+    // makespan = job's makespan
+    // minStartTime = earliest start time of job's ops
+    int makespan = job->makespan();
+    int minStartTime = int_t_max;
+    for (auto op : *job)
+    {
+        // skip summary, ignorable, and activity-less op
+        auto act = op->activity();
+        if ((op->type() == op_summary) || op->ignorable() || (act == nullptr))
         {
-            auto& report = _auditReport->joboverheadCost(job->id());
-            if (report.getName().empty())
-            {
-                report.setName(job->name());
-            }
-            for (auto& ipCost : _auditIpCosts)
-            {
-                auto info = new JobOverheadCostInfo();
-                info->interestPeriod = ipCost.first;
-                info->cost = ipCost.second;
-                report.costs()->push_back(info);
-            }
+            continue;
         }
 
-        // add this job's overhead cost to the total
-        jobOverheadCost += _totalCost - saveTotalCost;
+        // update minStartTime
+        minStartTime = min(minStartTime, act->es() + 1);
+    }
 
-        // so we can calculate the next job's overhead cost
-        saveTotalCost = _totalCost;
+    // overheadCostPerTS = overhead cost per time slot
+    double overheadCostPerTS = 0.0;
+    if (job->overheadCostPeriod() != period_undefined)
+    {
+        auto periodSeconds = periodToSeconds(job->overheadCostPeriod());
+        overheadCostPerTS = job->overheadCost() / ((double)periodSeconds / (double)_timeStep);
     }
-    setComponentScore("JobOverheadCost", (int)jobOverheadCost);
-    if (_audit)
+
+    // auditing -> print subheading for this Job
+    if (auditing(audit_jobs))
     {
-        *_os << "Total Job Overhead Cost: $" << jobOverheadCost << std::endl;
-        auto info = new ComponentScoreInfo();
-        info->name = "JobOverheadCost";
-        info->score = jobOverheadCost;
-        _auditReport->componentInfos()->push_back(info);
+        *_os << "WorkOrder id = " << job->id() << " name = " << job->name() << ": "
+             << "Job Overhead Cost" << std::endl;
+    }
+
+    // calculate interest period costs for this job
+    calcPeriodCost(ws, Span<int>(minStartTime, makespan), overheadCostPerTS);
+
+    // auditing -> record job's overhead cost in its JobOverheadCostReport
+    //             (with a JobOverheadCostInfo for each interest period)
+    if (auditing(audit_jobs))
+    {
+        auto& report = _auditReport->joboverheadCost(job->id());
+        if (report.getName().empty())
+        {
+            report.setName(job->name());
+        }
+        for (auto& ipCost : _auditIpCosts)
+        {
+            auto info = _auditReport->create<JobOverheadCostInfo>();
+            info->interestPeriod = ipCost.first;
+            info->cost = ipCost.second;
+            report.costs()->push_back(info);
+        }
     }
+
+    // this job's overhead cost
+    cost = ws.totalCost - saveTotalCost;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1754,18 +1984,19 @@ TotalCostEvaluator::calcJobOverheadCost(const SchedulingContext& context) const
 void
 TotalCostEvaluator::calcFixedCost(const SchedulingContext& context) const
 {
-    if (_audit)
+    auto& ws = _ws;
+    if (auditing(audit_jobs))
     {
         *_os << heading("calcFixedCost()", '-', 75) << std::endl;
     }
 
-    double saveTotalCost = _totalCost;
-    auto& ops = context.clevorDataSet()->ops();
-    for (auto op : ops)
+    double saveTotalCost = ws.totalCost;
+    for (auto& opHot : context.clevorDataSet()->opsHot())
     {
         // op must be active, non-summary, unstarted
-        if (!op->job()->active() || (op->type() == op_summary) ||
-            (op->status() != opstatus_unstarted))
+        auto op = opHot.op;
+        if (!opHot.jobHot->active || (opHot.status != opstatus_unstarted) ||
+            (op->type() == op_summary))
         {
             continue;
         }
@@ -1778,14 +2009,14 @@ TotalCostEvaluator::calcFixedCost(const SchedulingContext& context) const
         }
 
         // op must have an activity
-        auto act = op->activity();
+        auto act = opHot.act;
         if (act == nullptr)
         {
             continue;
         }
 
         // sip = SpanInterestPeriod that contains op's start time
-        //  ip = sip's index with _ipCosts[]
+        //  ip = sip's index with ws.ipCosts[]
         Span<int> searchSpan(act->es(), act->es() + 1);
         auto it = _ipSpans.findFirstIt(searchSpan);
         ASSERTD(it != _ipSpans.end());
@@ -1793,37 +2024,37 @@ TotalCostEvaluator::calcFixedCost(const SchedulingContext& context) const
         uint_t ip = sip->period;
 
         // auditing -> print subheading
-        if (_audit)
+        if (auditing(audit_jobs))
         {
             *_os << "Fixed Cost (op id = " << op->id() << "): "
                  << "$" << opCost << std::endl;
-            *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
+            *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
             auto& info = (*_auditReport->fixedCosts())[op->id()];
-            info = new FixedCostInfo();
+            info = _auditReport->create<FixedCostInfo>();
             info->opId = op->id();
             info->interestPeriod = ip;
             info->cost = opCost;
         }
 
         // add the fixed cost
-        _ipCosts[ip] += opCost;
-        _totalCost += opCost;
+        ws.ipCosts[ip] += opCost;
+        ws.totalCost += opCost;
 
         // auditing -> print added and total cost in this interest period
-        if (_audit)
+        if (auditing(audit_jobs))
         {
-            *_os << " + $" << opCost << " = $" << _ipCosts[ip] << std::endl;
+            *_os << " + $" << opCost << " = $" << ws.ipCosts[ip] << std::endl;
         }
     }
 
-    // assess total fixed cost as the addition to _totalCost that happened here
-    double totalFixedCost = _totalCost - saveTotalCost;
+    // assess total fixed cost as the addition to ws.totalCost that happened here
+    double totalFixedCost = ws.totalCost - saveTotalCost;
     setComponentScore("FixedCost", (int)totalFixedCost);
 
     // auditing -> add ComponentScoreInfo to _auditReport for fixed cost
     if (_audit)
     {
-        auto info = new ComponentScoreInfo();
+        auto info = _auditReport->create<ComponentScoreInfo>();
         info->name = "FixedCost";
         info->score = totalFixedCost;
         _auditReport->componentInfos()->push_back(info);
@@ -1835,12 +2066,13 @@ TotalCostEvaluator::calcFixedCost(const SchedulingContext& context) const
 void
 TotalCostEvaluator::calcResourceSequenceCost(const SchedulingContext& context) const
 {
-    if (_audit)
+    auto& ws = _ws;
+    if (auditing(audit_resources))
     {
         *_os << heading("calcResourceSequenceCost()", '-', 75) << std::endl;
     }
 
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = ws.totalCost;
     auto dataSet = context.clevorDataSet();
     auto& resources = dataSet->resources();
     for (auto res : resources)
@@ -1875,7 +2107,7 @@ TotalCostEvaluator::calcResourceSequenceCost(const SchedulingContext& context) c
             }
 
             // sip = SpanInterestPeriod that contains lhs activity's finish time
-            //  ip = sip's index with _ipCosts[]
+            //  ip = sip's index with ws.ipCosts[]
             Span<int> searchSpan(lhsAct->ef(), lhsAct->ef() + 1);
             auto it = _ipSpans.findFirstIt(searchSpan);
             ASSERTD(it != _ipSpans.end());
@@ -1883,14 +2115,14 @@ TotalCostEvaluator::calcResourceSequenceCost(const SchedulingContext& context) c
             uint_t ip = sip->period;
 
             // auditing -> print subheading
-            if (_audit)
+            if (auditing(audit_resources))
             {
                 *_os << "Resource Sequence Cost "
                      << "(res-id = " << dres->id() << ", lhs-op-id = " << lhsAct->id()
                      << ", rhs-op-id = " << rhsAct->id() << "): "
                      << "$" << cost << std::endl;
-                *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
-                auto info = new ResourceSequenceCostInfo();
+                *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
+                auto info = _auditReport->create<ResourceSequenceCostInfo>();
                 info->id = dres->id();
                 info->lhsId = lhsAct->id();
                 info->rhsId = rhsAct->id();
@@ -1900,25 +2132,25 @@ TotalCostEvaluator::calcResourceSequenceCost(const SchedulingContext& context) c
             }
 
             // add the cost
-            _ipCosts[ip] += cost;
-            _totalCost += cost;
+            ws.ipCosts[ip] += cost;
+            ws.totalCost += cost;
 
             // auditing -> print added and total cost for this interest period
-            if (_audit)
+            if (auditing(audit_resources))
             {
-                *_os << " + $" << cost << " = $" << _ipCosts[ip] << std::endl;
+                *_os << " + $" << cost << " = $" << ws.ipCosts[ip] << std::endl;
             }
         }
     }
 
-    // assess resource sequence cost as the addition to _totalCost that happened here
-    double totalResourceSequenceCost = _totalCost - saveTotalCost;
+    // assess resource sequence cost as the addition to ws.totalCost that happened here
+    double totalResourceSequenceCost = ws.totalCost - saveTotalCost;
     setComponentScore("ResourceSequenceCost", (int)totalResourceSequenceCost);
 
     // auditing -> add ComponentScoreInfo to _auditReport for resource sequence cost
     if (_audit)
     {
-        ComponentScoreInfo* info = new ComponentScoreInfo();
+        ComponentScoreInfo* info = _auditReport->create<ComponentScoreInfo>();
         info->name = "ResourceSequenceCost";
         info->score = totalResourceSequenceCost;
         _auditReport->componentInfos()->push_back(info);
@@ -1930,44 +2162,47 @@ TotalCostEvaluator::calcResourceSequenceCost(const SchedulingContext& context) c
 void
 TotalCostEvaluator::calcOverheadCost(const SchedulingContext& context) const
 {
+    auto& ws = _ws;
     // auditing -> print header
-    if (_audit)
+    if (auditing(audit_periods))
     {
         *_os << heading("calcOverheadCost()", '-', 75) << std::endl;
     }
 
     // makespan = schedule's makespan with end time rounded up to day's end
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = ws.totalCost;
     Span<int> makespan(_originTS, context.makespanTimeSlot());
     int tsPerDay = daySec / (uint_t)_schedulerConfig->timeStep();
     makespan.setEnd(roundUp(makespan.end(), tsPerDay));
 
     // auditing -> print subheading
-    if (_audit)
+    if (auditing(audit_periods))
     {
         *_os << "Overhead Cost" << std::endl;
     }
 
     // assess _overheadCostPerTS during makespan
-    calcPeriodCost(makespan, _overheadCostPerTS);
+    calcPeriodCost(ws, makespan, _overheadCostPerTS);
 
-    // assess overhead cost as the addition to _totalCost that happened here
-    double totalOverheadCost = _totalCost - saveTotalCost;
+    // assess overhead cost as the addition to ws.totalCost that happened here
+    double totalOverheadCost = ws.totalCost - saveTotalCost;
     setComponentScore("OverheadCost", (int)totalOverheadCost);
 
     // auditing -> add OverHeadCostInfo to _auditReport
     //          -> add ComponentScoreInfo for overhead cost
     if (_audit)
     {
-        std::map<uint_t, double>::const_iterator i;
-        for (i = _auditIpCosts.begin(); i != _auditIpCosts.end(); i++)
+        if (auditing(audit_periods))
         {
-            auto info = new OverheadCostInfo();
-            info->interestPeriod = i->first;
-            info->cost = i->second;
-            _auditReport->overheadCosts()->push_back(info);
+            for (auto& ipCost : _auditIpCosts)
+            {
+                auto info = _auditReport->create<OverheadCostInfo>();
+                info->interestPeriod = ipCost.first;
+                info->cost = ipCost.second;
+                _auditReport->overheadCosts()->push_back(info);
+            }
         }
-        auto info = new ComponentScoreInfo();
+        auto info = _auditReport->create<ComponentScoreInfo>();
         info->name = "OverheadCost";
         info->score = totalOverheadCost;
         _auditReport->componentInfos()->push_back(info);
@@ -1979,14 +2214,15 @@ TotalCostEvaluator::calcOverheadCost(const SchedulingContext& context) const
 void
 TotalCostEvaluator::calcInterestCost(const SchedulingContext& context) const
 {
+    auto& ws = _ws;
     // auditing -> print header
-    if (_audit)
+    if (auditing(audit_periods))
     {
         *_os << heading("calcInterestCost()", '-', 75) << std::endl;
     }
 
     int makeSpanEnd = context.makespanTimeSlot();
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = ws.totalCost;
     double totalCost = 0.0;
 
     // for each SpanInterestPeriod
@@ -2001,34 +2237,34 @@ TotalCostEvaluator::calcInterestCost(const SchedulingContext& context) const
         }
 
         // auditing -> print current interest period cost
-        if (_audit)
+        if (auditing(audit_periods))
         {
-            *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
+            *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
         }
 
-        _ipCosts[ip] += interestCost;
-        _totalCost += interestCost;
-        totalCost += _ipCosts[ip];
+        ws.ipCosts[ip] += interestCost;
+        ws.totalCost += interestCost;
+        totalCost += ws.ipCosts[ip];
 
         // auditing -> print added and total cost for this interest period
-        if (_audit)
+        if (auditing(audit_periods))
         {
-            *_os << " + $" << interestCost << " = $" << _ipCosts[ip] << std::endl;
-            auto info = new InterestCostInfo();
+            *_os << " + $" << interestCost << " = $" << ws.ipCosts[ip] << std::endl;
+            auto info = _auditReport->create<InterestCostInfo>();
             info->interestPeriod = ip;
             info->cost = interestCost;
             _auditReport->interestCosts()->push_back(info);
         }
     }
 
-    // assess interest cost as the addition to _totalCost that happened here
-    double totalInterestCost = _totalCost - saveTotalCost;
+    // assess interest cost as the addition to ws.totalCost that happened here
+    double totalInterestCost = ws.totalCost - saveTotalCost;
     setComponentScore("InterestCost", (int)totalInterestCost);
 
     // auditing -> add ComponentScoreInfo for interest cost
     if (_audit)
     {
-        auto info = new ComponentScoreInfo();
+        auto info = _auditReport->create<ComponentScoreInfo>();
         info->name = "InterestCost";
         info->score = totalInterestCost;
         _auditReport->componentInfos()->push_back(info);
@@ -2038,7 +2274,9 @@ TotalCostEvaluator::calcInterestCost(const SchedulingContext& context) const
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void
-TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span, double costPerTS) const
+TotalCostEvaluator::calcPeriodCost(Workspace& ws,
+                                   const utl::Span<int>& p_span,
+                                   double costPerTS) const
 {
     // auditing -> clear interest period costs in audit
     if (_audit)
@@ -2053,7 +2291,7 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span, double costPerT
     }
 
     auto span = p_span;
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = ws.totalCost;
 
     // auditing -> print subheading
     if (_audit)
@@ -2079,17 +2317,17 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span, double costPerT
         // auditing -> print current interest period cost
         if (_audit)
         {
-            *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
+            *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
         }
 
         // add the cost for this interest period
-        _ipCosts[ip] += cost;
-        _totalCost += cost;
+        ws.ipCosts[ip] += cost;
+        ws.totalCost += cost;
 
         // auditing -> print added and total cost for this interest period
         if (_audit)
         {
-            *_os << " + $" << cost << " = $" << _ipCosts[ip] << std::endl;
+            *_os << " + $" << cost << " = $" << ws.ipCosts[ip] << std::endl;
             _auditIpCosts[ip] = cost;
         }
     }
@@ -2097,14 +2335,15 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span, double costPerT
     // auditing -> print total
     if (_audit)
     {
-        *_os << "    total: $" << (_totalCost - saveTotalCost) << std::endl;
+        *_os << "    total: $" << (ws.totalCost - saveTotalCost) << std::endl;
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void
-TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span,
+TotalCostEvaluator::calcPeriodCost(Workspace& ws,
+                                   const utl::Span<int>& p_span,
                                    double costPerTS,
                                    double incrCost,
                                    double periodSeconds,
@@ -2123,7 +2362,7 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span,
     }
 
     auto span = p_span;
-    double saveTotalCost = _totalCost;
+    double saveTotalCost = ws.totalCost;
 
     // auditing -> print subheading
     if (_audit)
@@ -2151,7 +2390,7 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span,
         // auditing -> print current interest period cost
         if (_audit)
         {
-            *_os << "    i.p. " << ip << ": $" << _ipCosts[ip];
+            *_os << "    i.p. " << ip << ": $" << ws.ipCosts[ip];
         }
 
         // overlap is at least periodSteps in size AND incrCost > 1.0?
@@ -2176,13 +2415,13 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span,
         }
 
         // add the cost for this interest period
-        _ipCosts[ip] += cost;
-        _totalCost += cost;
+        ws.ipCosts[ip] += cost;
+        ws.totalCost += cost;
 
         // auditing -> print the added and total cost for this interest period
         if (_audit)
         {
-            *_os << " + " << cost << " = $" << _ipCosts[ip] << std::endl;
+            *_os << " + " << cost << " = $" << ws.ipCosts[ip] << std::endl;
             _auditIpCosts[ip] = cost;
         }
     }
@@ -2190,7 +2429,7 @@ TotalCostEvaluator::calcPeriodCost(const utl::Span<int>& p_span,
     // auditing -> print total
     if (_audit)
     {
-        *_os << "    total: $" << (_totalCost - saveTotalCost) << std::endl;
+        *_os << "    total: $" << (ws.totalCost - saveTotalCost) << std::endl;
     }
 }
 
@@ -3,6 +3,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <libutl/SpanCol.h>
+#include <lut/ThreadPool.h>
 #include <cls/DiscreteResource.h>
 #include <cse/ResourceCost.h>
 #include <cse/ScheduleEvaluator.h>
@@ -96,6 +97,20 @@ class CapSpan;
    (TotalCostEvaluatorConfiguration::interestRate), compounding in each period
    (TotalCostEvaluatorconfiguration::interestRatePeriod).
 
+   ##Parallel Evaluation
+
+   If TotalCostEvaluatorConfiguration::numThreads is greater than one, the cost of each
+   cls::DiscreteResource and the opportunity/inventory/lateness and overhead costs of each Job are
+   calculated in parallel.  Each thread accumulates interest-period costs in its own Workspace,
+   and the per-thread totals are reduced (in thread order) before interest cost is calculated.
+   Auditing always uses a single thread so the audit text is written in order.
+
+   ##Auditing
+
+   An audit only collects the sections of the AuditReport (and the audit text) that were asked
+   for (see setAuditSections).  The report's infos are allocated from an arena (see AuditArena),
+   and the text is only written if audit_text is included.
+
    \see TotalCostEvaluatorConfiguration
    \see cse::DiscreteResource
    \see cls::DiscreteResource
@@ -118,46 +133,147 @@ public:
 
     virtual double calcScore(const gop::IndBuilderContext* context) const;
 
+    /**
+       Get a lower bound on the total cost of a partial (forward) schedule.
+       Each job's opportunity and lateness costs are calculated for its earliest possible
+       completion (see Job::makespanLowerBound), since they can only grow if it completes later.
+       The other costs are non-negative (so they're bounded by zero), except for interest cost,
+       so there's no bound when an interest rate is given.
+    */
+    virtual double scoreLowerBound(const gop::IndBuilderContext* context) const;
+
+    /** Evaluation records each resource's cost in its ResourceCost. */
+    virtual bool
+    sharesState() const
+    {
+        return true;
+    }
+
+    /** Get the audit report (made by the last audit). */
     AuditReport*
     auditReport() const
     {
         return _auditReport;
     }
 
+    /** Get the audit sections that an audit will collect (see audit_section_t). */
+    uint_t
+    auditSections() const
+    {
+        return _auditSections;
+    }
+
+    /** Set the audit sections that an audit will collect (see audit_section_t). */
+    void
+    setAuditSections(uint_t sections)
+    {
+        _auditSections = sections;
+    }
+
+    /** Get the number of threads that calcScore uses. */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
+
+    /**
+       Set the number of threads that calcScore uses (overriding
+       TotalCostEvaluatorConfiguration::numThreads).
+    */
+    void setNumThreads(uint_t numThreads);
+
 private:
     using ispancol_t = utl::SpanCol<int>;
     using cslist_t = std::deque<CapSpan*>;
     using spanip_col_t = utl::TRBtree<utl::Span<int>>;
+    using dres_vector_t = std::vector<const cls::DiscreteResource*>;
+
+    /**
+       Costing state for one thread: accumulated costs, and scratch space for cslistCost().
+    */
+    struct Workspace
+    {
+        Workspace();
+        ~Workspace();
+
+        /** Zero the accumulated costs (for the given number of interest periods). */
+        void clear(uint_t numIPs);
+
+        double* ipCosts;
+        size_t ipCostsSize;
+        double totalCost;
+        byte_t* dayIsBreak;
+        size_t dayIsBreakSize;
+        uint_t* caps;
+        size_t capsSize;
+        uint_t* capDayTimes;
+        size_t capDayTimesSize;
+        uint_t* capDayHires;
+        size_t capDayHiresSize;
+        byte_t* capDayFireBeforeHire;
+        size_t capDayFireBeforeHireSize;
+        double* dayCosts;
+        size_t dayCostsSize;
+        uint_t* dayCostPeriods;
+        size_t dayCostPeriodsSize;
+    };
+
+    using task_func_t = std::function<void(uint_t taskIdx, Workspace& ws)>;
 
 private:
     void init();
     void deInit();
 
+    bool
+    parallel() const
+    {
+        return (_numThreads > 1) && !_audit;
+    }
+
+    bool
+    auditing(uint_t section) const
+    {
+        return _audit && ((_auditSections & section) != 0);
+    }
+
+    void runParallel(uint_t numTasks, const task_func_t& func) const;
+
     void calcResourceCost(const SchedulingContext& context) const;
+    void calcResourceCost(const SchedulingContext& context,
+                          const cls::DiscreteResource& res,
+                          Workspace& ws) const;
     void cslistBuild(const SchedulingContext& context,
                      const cls::DiscreteResource& res,
                      cslist_t& cslist) const;
     void cslistDump(const cslist_t& cslist) const;
     void cslistCost(const SchedulingContext& context,
                     const cls::DiscreteResource& res,
-                    const cslist_t& cslist) const;
+                    const cslist_t& cslist,
+                    Workspace& ws) const;
 
     void calcLatenessCost(const SchedulingContext& context) const;
+    void calcLatenessCost(const SchedulingContext& context,
+                          const Job* job,
+                          Workspace& ws,
+                          double* costs) const;
     void calcJobOverheadCost(const SchedulingContext& context) const;
+    void calcJobOverheadCost(const Job* job, Workspace& ws, double& cost) const;
     void calcFixedCost(const SchedulingContext& context) const;
     void calcResourceSequenceCost(const SchedulingContext& context) const;
     void calcOverheadCost(const SchedulingContext& context) const;
     void calcInterestCost(const SchedulingContext& context) const;
 
-    void calcPeriodCost(const utl::Span<int>& span, double costPerTS) const;
-    void calcPeriodCost(const utl::Span<int>& span,
+    void calcPeriodCost(Workspace& ws, const utl::Span<int>& span, double costPerTS) const;
+    void calcPeriodCost(Workspace& ws,
+                        const utl::Span<int>& span,
                         double costPerTS,
                         double incrCost,
                         double periodSeconds,
                         double timeStep) const;
 
 private:
-    mutable std::ostringstream* _os;
+    mutable std::ostream* _os;
     int _originTS;
     int _horizonTS;
     uint_t _timeStep;
@@ -166,22 +282,14 @@ private:
     double _interestRate;
     uint_t _numIPs;
     spanip_col_t _ipSpans;
-    mutable double* _ipCosts;
-    mutable double _totalCost;
-    mutable byte_t* _dayIsBreak;
-    mutable size_t _dayIsBreakSize;
-    mutable uint_t* _caps;
-    mutable size_t _capsSize;
-    mutable uint_t* _capDayTimes;
-    mutable size_t _capDayTimesSize;
-    mutable uint_t* _capDayHires;
-    mutable size_t _capDayHiresSize;
-    mutable byte_t* _capDayFireBeforeHire;
-    mutable size_t _capDayFireBeforeHireSize;
-    mutable double* _dayCosts;
-    mutable size_t _dayCostsSize;
-    mutable uint_t* _dayCostPeriods;
-    mutable size_t _dayCostPeriodsSize;
+    uint_t _numThreads;
+    mutable Workspace _ws;
+    mutable std::vector<Workspace*> _workspaces;
+    mutable lut::ThreadPool* _threadPool;
+    mutable dres_vector_t _costedResources;
+    mutable job_vector_t _jobs;
+    mutable std::vector<double> _jobCosts;
+    uint_t _auditSections;
     mutable AuditReport* _auditReport;
     mutable std::map<uint_t, double> _auditIpCosts;
 };
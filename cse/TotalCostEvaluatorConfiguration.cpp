@@ -1,4 +1,5 @@
 #include "libcse.h"
+#include <gop/ConfigEx.h>
 #include "TotalCostEvaluatorConfiguration.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +18,11 @@ CSE_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// serialization format version (see TotalCostEvaluatorConfiguration)
+static const uint_t formatVersion = 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 TotalCostEvaluatorConfiguration::copy(const Object& rhs)
 {
@@ -26,6 +32,7 @@ TotalCostEvaluatorConfiguration::copy(const Object& rhs)
     _interestRatePeriod = cf._interestRatePeriod;
     _overheadCost = cf._overheadCost;
     _overheadCostPeriod = cf._overheadCostPeriod;
+    _numThreads = cf._numThreads;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,11 +40,22 @@ TotalCostEvaluatorConfiguration::copy(const Object& rhs)
 void
 TotalCostEvaluatorConfiguration::serialize(Stream& stream, uint_t io, uint_t)
 {
+    // the format version comes first
+    uint_t version = formatVersion;
+    utl::serialize(version, stream, io);
+    if (version > formatVersion)
+    {
+        throw ConfigEx();
+    }
     super::serialize(stream, io);
     utl::serialize(_interestRate, stream, io);
     utl::serialize((uint_t&)_interestRatePeriod, stream, io);
     utl::serialize(_overheadCost, stream, io);
     utl::serialize((uint_t&)_overheadCostPeriod, stream, io);
+    if (version >= 1)
+    {
+        utl::serialize(_numThreads, stream, io);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +67,7 @@ TotalCostEvaluatorConfiguration::init()
     _interestRatePeriod = period_undefined;
     _overheadCost = 0.0;
     _overheadCostPeriod = period_undefined;
+    _numThreads = 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
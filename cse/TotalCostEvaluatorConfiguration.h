@@ -13,6 +13,12 @@ CSE_NS_BEGIN;
 /**
    Configuration parameters for TotalCostEvaluator.
 
+   A serialized TotalCostEvaluatorConfiguration begins with its format version, so a stream in an
+   older format can still be read (the settings that were added since keep their default values):
+
+   - 0 : original format
+   - 1 : adds numThreads
+
    \ingroup cse
 */
 
@@ -56,6 +62,17 @@ public:
     {
         return _overheadCostPeriod;
     }
+
+    /**
+       Get the number of threads used for costing.
+       With more than one thread, resource and job costs are calculated in parallel
+       (except when auditing).
+    */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
     //@}
 
     /// \name Accessors (non-const)
@@ -87,6 +104,13 @@ public:
     {
         _overheadCostPeriod = overheadCostPeriod;
     }
+
+    /** Set the number of threads used for costing. */
+    void
+    setNumThreads(uint_t numThreads)
+    {
+        _numThreads = numThreads;
+    }
     //@}
 
 private:
@@ -101,6 +125,7 @@ private:
     lut::period_t _interestRatePeriod;
     double _overheadCost;
     lut::period_t _overheadCostPeriod;
+    uint_t _numThreads;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@ AR_SAoptimizer::initialize(const OptimizerConfiguration* config)
     super::initialize(config);
     _populationSize = 1;
     _fixedInitTemp = false;
+    _coolingSchedule = cooling_geometric; // re-annealing sets the temperature
     _initTemp = _currentTemp = 1000.0;
     _stopTemp = 0.001;
     init();
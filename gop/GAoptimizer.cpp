@@ -0,0 +1,423 @@
+#include "libgop.h"
+#include "ConfigEx.h"
+#include "GAoptimizer.h"
+#include "RevOperator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef DEBUG
+#define DEBUG_UNIT
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(gop::GAoptimizer);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::initialize(const OptimizerConfiguration* config)
+{
+    Optimizer::initialize(config);
+
+    // initialize _ind
+    ASSERTD(_ind != nullptr);
+    _indBuilder->initializeInd(_ind, config->dataSet(), _rng);
+    _singleStep = false;
+
+    // construct our initial individual and set initial & best scores
+    iterationRun();
+    setInitScore(utl::clone(_newScore));
+    setBestScore(utl::clone(_newScore));
+    if (_ind->newString())
+        _ind->acceptNewString();
+    auto objective = _objectives[0];
+    objective->setBestScore(utl::clone(_bestScore));
+    _bestString = utl::clone(_ind->stringPtr());
+
+#ifdef DEBUG_UNIT
+    utl::cout << initString(!_fail) << utl::endlf;
+#endif
+
+    // find the sequence segments
+    _indBuilder->getSequenceSegments(config->dataSet(), _seqSegments);
+
+    // offspring are constructed in parallel (one per thread)
+    _parallelIndBuilder.initialize(config, _context, _indBuilder, objective, _ind, _rng);
+    for (uint_t i = 0; i != numThreads(); ++i)
+    {
+        _offspring.push_back(lut::clone(_ind));
+        _offspringScores.push_back(utl::clone(_bestScore));
+        _offspringOps.push_back(nullptr);
+    }
+
+    initializePopulation();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+GAoptimizer::run()
+{
+    ASSERTD(!complete());
+    ASSERTD(_ind != nullptr);
+
+    auto objective = _objectives[0];
+    bool complete = this->complete();
+
+    while (!complete)
+    {
+        // no iterations left (e.g. the run was stopped before its first iteration)?
+        if (_iteration >= _maxIterations)
+        {
+            break;
+        }
+
+        // breed a batch of offspring, and construct them in parallel
+        uint_t numOffspring = utl::min(numThreads(), _maxIterations - _iteration);
+        for (uint_t i = 0; i != numOffspring; ++i)
+        {
+            breed(i);
+        }
+        _parallelIndBuilder.run(_offspring, _offspringScores, numOffspring);
+
+        // consider each offspring for admission to the population
+        for (uint_t i = 0; i != numOffspring; ++i)
+        {
+            _iteration++;
+            auto offspring = _offspring[i];
+            auto& score = _offspringScores[i];
+            copyNewScore(score);
+            _fail = ((score->getType() != score_succeeded) &&
+                     (score->getType() != score_ct_violated));
+            int cmpResult = objective->compare(score, _bestScore);
+            _sameScore = (cmpResult == 0);
+            _newBest = (cmpResult > 0);
+            if (_newBest)
+            {
+                auto rop = dynamic_cast<RevOperator*>(_offspringOps[i]);
+                if (rop != nullptr)
+                {
+                    rop->addSuccessIter();
+                }
+                _improvementIteration = _iteration;
+                copyBestScore(score);
+                _bestString->copy(offspring->string());
+                objective->copyBestScore(_bestScore);
+            }
+            _accept = replaceWorst(offspring, score);
+#ifdef DEBUG_UNIT
+            utl::cout << iterationString() << utl::endl;
+#endif
+            complete = this->complete();
+            if (complete)
+            {
+                break;
+            }
+            updateRunStatus(false);
+        }
+    }
+    ASSERT(this->complete() || (_iteration >= _maxIterations));
+
+    // re-generate the best schedule and get audit text
+    _ind->setString(_bestString, false);
+    bool scheduleFeasible = iterationRun(nullptr, true);
+#ifdef DEBUG
+    if (scheduleFeasible)
+        ASSERTD(*_bestScore == *_newScore);
+#endif
+    utl::cout << finalString(scheduleFeasible) << utl::endlf;
+    updateRunStatus(true);
+    return scheduleFeasible;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::audit()
+{
+    ASSERTD(_bestString != nullptr);
+    _ind->setString(_bestString, false);
+    if (!iterationRun(nullptr, true))
+        ABORT();
+    ASSERTD(*_bestScore == *_newScore);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::init()
+{
+    _popSize = 20;
+    _pop = new Population(true);
+    _bestString = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::deInit()
+{
+    // _ind may refer to _bestString
+    if (_ind != nullptr)
+    {
+        _ind->setString(nullptr);
+    }
+    delete _pop;
+    deleteCont(_scores);
+    delete _bestString;
+    deleteCont(_offspring);
+    deleteCont(_offspringScores);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::initializePopulation()
+{
+    // the initial individual, and mutated copies of it
+    stringind_vector_t inds;
+    for (uint_t i = 0; i != _popSize; ++i)
+    {
+        auto ind = lut::clone(_ind);
+        if (i > 0)
+        {
+            mutate(ind);
+        }
+        _pop->add(ind);
+        _scores.push_back(utl::clone(_bestScore));
+        inds.push_back(ind);
+    }
+
+    // construct the mutated copies
+    _parallelIndBuilder.run(inds, _scores, _popSize);
+    for (uint_t i = 0; i != _popSize; ++i)
+    {
+        inds[i]->setScore(0, _scores[i]->getValue());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+GAoptimizer::selectParent() const
+{
+    // binary tournament
+    uint_t lhsIdx = _rng->uniform((uint_t)0, _popSize - 1);
+    uint_t rhsIdx = _rng->uniform((uint_t)0, _popSize - 1);
+    int cmpResult = _objectives[0]->compare(_scores[lhsIdx], _scores[rhsIdx]);
+    return (cmpResult >= 0) ? lhsIdx : rhsIdx;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::breed(uint_t offspringIdx)
+{
+    // select two (different) parents
+    uint_t lhsIdx = selectParent();
+    uint_t rhsIdx = selectParent();
+    for (uint_t i = 0; (rhsIdx == lhsIdx) && (i != 4); ++i)
+    {
+        rhsIdx = selectParent();
+    }
+    auto& lhs = *_pop->get(lhsIdx);
+    auto& rhs = *_pop->get(rhsIdx);
+
+    // single-point crossover
+    auto offspring = _offspring[offspringIdx];
+    uint_t stringSize = lhs.size();
+    uint_t pos = (stringSize > 1) ? _rng->uniform((uint_t)1, stringSize - 1) : 0;
+    lhs.crossover(offspring, nullptr, rhs, pos);
+
+    // order crossover for sequence segments
+    auto& offspringStr = offspring->string();
+    for (auto& segment : _seqSegments)
+    {
+        orderCrossover(offspringStr, lhs.string(), rhs.string(), segment);
+    }
+
+    // mutation
+    _offspringOps[offspringIdx] = mutate(offspring);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+GAoptimizer::orderCrossover(String<uint_t>& offspring,
+                            const String<uint_t>& lhs,
+                            const String<uint_t>& rhs,
+                            const string_segment_t& segment)
+{
+    // start with a copy of lhs's segment
+    uint_t begin = segment.first;
+    uint_t end = segment.second;
+    for (uint_t i = begin; i != end; ++i)
+    {
+        offspring[i] = lhs[i];
+    }
+
+    // find the sequenced positions (unsequenced items are left in place)
+    _positions.clear();
+    _lhsVals.clear();
+    _rhsVals.clear();
+    for (uint_t i = begin; i != end; ++i)
+    {
+        if (lhs[i] != uint_t_max)
+        {
+            _positions.push_back(i);
+            _lhsVals.push_back(lhs[i]);
+        }
+        if (rhs[i] != uint_t_max)
+        {
+            _rhsVals.push_back(rhs[i]);
+        }
+    }
+    uint_t n = _positions.size();
+    if (n < 2)
+    {
+        return;
+    }
+
+    // lhs and rhs must sequence the same items
+    std::sort(_lhsVals.begin(), _lhsVals.end());
+    std::sort(_rhsVals.begin(), _rhsVals.end());
+    if (_lhsVals != _rhsVals)
+    {
+        return;
+    }
+
+    // the offspring inherits the slice [sliceBegin,sliceEnd) from lhs
+    uint_t sliceBegin = _rng->uniform((uint_t)0, n - 1);
+    uint_t sliceEnd = _rng->uniform(sliceBegin + 1, n);
+    _keptVals.clear();
+    for (uint_t i = sliceBegin; i != sliceEnd; ++i)
+    {
+        _keptVals.push_back(lhs[_positions[i]]);
+    }
+    std::sort(_keptVals.begin(), _keptVals.end());
+    _keptUsed.assign(_keptVals.size(), false);
+
+    // fill the other positions with the remaining items, in rhs's order
+    uint_t dst = 0;
+    for (uint_t i = begin; i != end; ++i)
+    {
+        uint_t val = rhs[i];
+        if (val == uint_t_max)
+        {
+            continue;
+        }
+
+        // val was inherited from lhs?
+        auto it = std::lower_bound(_keptVals.begin(), _keptVals.end(), val);
+        while ((it != _keptVals.end()) && (*it == val) && _keptUsed[it - _keptVals.begin()])
+        {
+            ++it;
+        }
+        if ((it != _keptVals.end()) && (*it == val))
+        {
+            _keptUsed[it - _keptVals.begin()] = true;
+            continue;
+        }
+
+        if (dst == sliceBegin)
+        {
+            dst = sliceEnd;
+        }
+        ASSERTD(dst < n);
+        offspring[_positions[dst++]] = val;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Operator*
+GAoptimizer::mutate(StringInd<uint_t>* ind)
+{
+    auto op = chooseRandomOp();
+    if (op == nullptr)
+    {
+        return nullptr;
+    }
+    auto rop = dynamic_cast<RevOperator*>(op);
+    if (rop != nullptr)
+    {
+        rop->addTotalIter();
+    }
+    try
+    {
+        _context->clear();
+        op->execute(ind, _context, _singleStep);
+    }
+    catch (utl::Exception& ex)
+    {
+        // a configuration error isn't a failed mutation
+        if (ex.isA(ConfigEx))
+        {
+            throw;
+        }
+
+        // the mutation failed -> the offspring keeps its crossover string
+        _context->setFailed();
+        if (rop != nullptr)
+        {
+            rop->undo();
+        }
+        return nullptr;
+    }
+    if (rop != nullptr)
+    {
+        rop->accept();
+    }
+    return op;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+GAoptimizer::replaceWorst(const StringInd<uint_t>* ind, Score*& score)
+{
+    auto objective = _objectives[0];
+    auto& str = ind->string();
+
+    // find the worst member (and reject a duplicate)
+    uint_t worstIdx = 0;
+    for (uint_t i = 0; i != _popSize; ++i)
+    {
+        auto& memberStr = _pop->get(i)->string();
+        if (std::equal(str.get(), str.get() + str.size(), memberStr.get()))
+        {
+            return false;
+        }
+        if (objective->compare(_scores[i], _scores[worstIdx]) < 0)
+        {
+            worstIdx = i;
+        }
+    }
+
+    // offspring isn't better than the worst member -> reject it
+    if (objective->compare(score, _scores[worstIdx]) <= 0)
+    {
+        return false;
+    }
+
+    // replace the worst member
+    auto worst = _pop->get(worstIdx);
+    worst->string().copy(str);
+    std::swap(_scores[worstIdx], score);
+    worst->setScore(0, _scores[worstIdx]->getValue());
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -0,0 +1,108 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gop/Optimizer.h>
+#include <gop/ParallelIndBuilder.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Steady-state genetic algorithm.
+
+   GAoptimizer maintains a Population of individuals.  Each iteration breeds one offspring from
+   two parents chosen by binary tournament:
+
+   - the parents' strings are recombined by single-point crossover
+   - each sequence segment (see IndBuilder::getSequenceSegments) is instead recombined by order
+     crossover, so it remains a permutation of the items it sequences
+   - the offspring is mutated by a randomly chosen operator
+
+   If the offspring is better than the worst member of the population (and isn't a duplicate of
+   an existing member), it replaces that member.
+
+   Offspring are bred in batches of OptimizerConfiguration::numThreads(), and each batch is
+   constructed and evaluated in parallel (see ParallelIndBuilder).
+
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class GAoptimizer : public Optimizer
+{
+    UTL_CLASS_DECL(GAoptimizer, Optimizer);
+
+public:
+    /** Initialize. */
+    virtual void initialize(const OptimizerConfiguration* config);
+
+    /** Run the genetic algorithm. */
+    virtual bool run();
+
+    /** Audit the result. */
+    virtual void audit();
+
+    /** Get the population size. */
+    uint_t
+    populationSize() const
+    {
+        return _popSize;
+    }
+
+    /** Get the number of threads. */
+    uint_t
+    numThreads() const
+    {
+        return _parallelIndBuilder.numThreads();
+    }
+
+protected:
+    virtual double
+    workersCPUtime() const
+    {
+        return _parallelIndBuilder.cpuTime();
+    }
+
+private:
+    void init();
+    void deInit();
+
+    void initializePopulation();
+    uint_t selectParent() const;
+    void breed(uint_t offspringIdx);
+    void orderCrossover(String<uint_t>& offspring,
+                        const String<uint_t>& lhs,
+                        const String<uint_t>& rhs,
+                        const string_segment_t& segment);
+    Operator* mutate(StringInd<uint_t>* ind);
+    bool replaceWorst(const StringInd<uint_t>* ind, Score*& score);
+
+private:
+    uint_t _popSize;
+    Population* _pop;
+    score_vector_t _scores;
+    String<uint_t>* _bestString;
+    string_segment_vector_t _seqSegments;
+
+    // offspring (one per thread)
+    stringind_vector_t _offspring;
+    score_vector_t _offspringScores;
+    op_vector_t _offspringOps;
+    ParallelIndBuilder _parallelIndBuilder;
+
+    // scratch space for orderCrossover()
+    std::vector<uint_t> _positions;
+    std::vector<uint_t> _lhsVals;
+    std::vector<uint_t> _rhsVals;
+    std::vector<uint_t> _keptVals;
+    std::vector<bool> _keptUsed;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
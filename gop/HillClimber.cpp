@@ -105,7 +105,11 @@ HillClimber::HCiterationRun()
     utl::cout << "                                      " << op->toString() << utl::endl;
 #endif
 
-    // construct the new solution
+    // construct the new solution (abandoning it once it can't be accepted)
+    if (_bestScore->getType() == score_succeeded)
+    {
+        setScoreBound(_bestScore->getValue());
+    }
     iterationRun(rop);
 
     // decide whether accept the new solution
@@ -136,8 +140,8 @@ HillClimber::acceptanceEval(RevOperator* op)
         {
             _improvementIteration = _iteration;
             op->addSuccessIter();
-            setBestScore(utl::clone(_newScore));
-            objective->setBestScore(utl::clone(_bestScore));
+            copyBestScore(_newScore);
+            objective->copyBestScore(_bestScore);
         }
     }
     else
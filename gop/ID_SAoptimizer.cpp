@@ -32,6 +32,7 @@ ID_SAoptimizer::initialize(const OptimizerConfiguration* config)
     super::initialize(config);
     _populationSize = 1;
     _fixedInitTemp = false;
+    _coolingSchedule = cooling_geometric; // re-annealing sets the temperature
     _stopTemp = 0.0001;
     _initTemp = _currentTemp = _stopTemp;
     init();
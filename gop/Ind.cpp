@@ -57,7 +57,8 @@ Ind::toString() const
 bool
 Ind::dominates(const Ind* rhs, const objective_vector_t& objectives) const
 {
-    // self dominates rhs if all self's scores are better
+    // self dominates rhs if no score is worse, and at least one score is better
+    bool better = false;
     uint_t i;
     uint_t numScores = _scores.size();
     for (i = 0; i < numScores; ++i)
@@ -65,12 +66,14 @@ Ind::dominates(const Ind* rhs, const objective_vector_t& objectives) const
         auto objective = objectives[i];
         auto lhsScore = _scores[i];
         auto rhsScore = rhs->_scores[i];
-        if (objective->compare(lhsScore, rhsScore) <= 0)
+        int cmpResult = objective->compare(lhsScore, rhsScore);
+        if (cmpResult < 0)
         {
             return false;
         }
+        better = better || (cmpResult > 0);
     }
-    return true;
+    return better;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,7 +55,10 @@ public:
     /** Clear the build. */
     virtual void buildClear() = 0;
 
-    /** Does self dominate the given individual? */
+    /**
+       Does self (Pareto-)dominate the given individual?
+       Self dominates rhs if no score is worse than rhs's, and at least one score is better.
+    */
     bool dominates(const Ind* rhs, const objective_vector_t& objectives) const;
 
     /** Get the population that self belongs to. */
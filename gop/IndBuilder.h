@@ -11,6 +11,14 @@ GOP_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/** A segment `[begin,end)` of a construction string. */
+using string_segment_t = std::pair<uint_t, uint_t>;
+
+/** Vector of string segments. */
+using string_segment_vector_t = std::vector<string_segment_t>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    Individual construction strategy (abstract).
 
@@ -62,6 +70,18 @@ public:
        \param context construction context
     */
     virtual void run(Ind* ind, IndBuilderContext* context) const = 0;
+
+    /**
+       Get the sequence segments of the string.
+       Each sequence segment holds a permutation that orders a set of items, so an operation that
+       recombines strings must keep each sequence segment a permutation of its original values.
+       \param dataSet active DataSet
+       \param segments (output) sequence segments
+    */
+    virtual void
+    getSequenceSegments(const DataSet* dataSet, string_segment_vector_t& segments) const
+    {
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
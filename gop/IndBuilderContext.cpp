@@ -1,5 +1,6 @@
 #include "libgop.h"
 #include "IndBuilderContext.h"
+#include "IndEvaluator.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -28,6 +29,20 @@ void
 IndBuilderContext::clear()
 {
     _failed = false;
+    _pruned = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+IndBuilderContext::checkScoreBound()
+{
+    ASSERTD(_boundEvaluator != nullptr);
+    if (_boundEvaluator->scoreLowerBound(this) > _scoreBound)
+    {
+        _pruned = true;
+    }
+    return _pruned;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
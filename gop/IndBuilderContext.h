@@ -7,6 +7,8 @@ GOP_NS_BEGIN;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class DataSet;
+class IndEvaluator;
+class RunStatus;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -31,6 +33,24 @@ public:
     /** Get the data-set. */
     virtual const DataSet* dataSet() const = 0;
 
+    /**
+       Make a worker context.
+       A worker context has its own copy of the data-set, so it can be used to construct
+       individuals on another thread, concurrently with this context.
+       \return new worker context (nullptr if not supported)
+    */
+    virtual IndBuilderContext*
+    makeWorkerContext() const
+    {
+        return nullptr;
+    }
+
+    /** Add the context's own statistics to the run status (e.g. see cse::SchedulingContext). */
+    virtual void
+    updateRunStatus(RunStatus* runStatus) const
+    {
+    }
+
     /** Has construction failed? */
     bool
     failed() const
@@ -45,11 +65,58 @@ public:
         _failed = failed;
     }
 
+    /// \name Score Bound
+    //@{
+    /**
+       Set the score bound for the next construction.
+       The construction can be abandoned once the evaluator's lower bound on its score exceeds
+       the bound (see checkScoreBound).
+       \param evaluator evaluator (of a minimized score)
+       \param bound worst acceptable score
+    */
+    void
+    setScoreBound(const IndEvaluator* evaluator, double bound)
+    {
+        _boundEvaluator = evaluator;
+        _scoreBound = bound;
+    }
+
+    /** Remove the score bound. */
+    void
+    clearScoreBound()
+    {
+        _boundEvaluator = nullptr;
+    }
+
+    /** Is there a score bound? */
+    bool
+    scoreBounded() const
+    {
+        return (_boundEvaluator != nullptr);
+    }
+
+    /**
+       Check the score bound.
+       \return true iff the construction can't meet the bound (and should be abandoned)
+    */
+    bool checkScoreBound();
+
+    /** Was the construction abandoned because it couldn't meet the score bound? */
+    bool
+    pruned() const
+    {
+        return _pruned;
+    }
+    //@}
+
 private:
     void
     init()
     {
         _failed = false;
+        _boundEvaluator = nullptr;
+        _scoreBound = 0.0;
+        _pruned = false;
     }
     void
     deInit()
@@ -58,6 +125,9 @@ private:
 
 private:
     bool _failed;
+    const IndEvaluator* _boundEvaluator;
+    double _scoreBound;
+    bool _pruned;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
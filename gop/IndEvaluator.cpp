@@ -48,4 +48,14 @@ IndEvaluator::setComponentScore(const std::string& componentName, int score) con
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+IndEvaluator::eval(const IndBuilderContext* context, Score& score) const
+{
+    auto newScore = eval(context);
+    score.copy(*newScore);
+    delete newScore;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 GOP_NS_END;
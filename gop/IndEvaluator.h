@@ -79,6 +79,43 @@ public:
     */
     virtual Score* eval(const IndBuilderContext* context) const = 0;
 
+    /**
+       Evaluate a constructed individual into an existing Score object.
+
+       Optimizers call this once per iteration, so it lets an evaluator avoid allocating a new
+       Score each time.  The default implementation copies the result of eval(context).
+
+       \param context construction context
+       \param score (out) individual's score
+    */
+    virtual void eval(const IndBuilderContext* context, Score& score) const;
+
+    /**
+       Get a lower bound on the score of a partially constructed individual.
+
+       Only meaningful for a minimized score: the individual's score (if its construction
+       succeeds) won't be less than this, however its construction is completed.  The default
+       implementation provides no bound.
+
+       \param context construction context
+    */
+    virtual double
+    scoreLowerBound(const IndBuilderContext* context) const
+    {
+        return -utl::double_t_max;
+    }
+
+    /**
+       Does evaluation modify state that's shared with other evaluators (e.g. results recorded in
+       the data set's objects)?  Such an evaluator isn't evaluated at the same time as another one
+       (see ParallelObjectiveEvaluator).
+    */
+    virtual bool
+    sharesState() const
+    {
+        return false;
+    }
+
 protected:
     mutable bool _audit;
     mutable std::string _auditText;
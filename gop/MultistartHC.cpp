@@ -115,7 +115,7 @@ MultistartHC::run()
                 rop->accept();
                 if (cmpResult > 0)
                 {
-                    _strScores[i]->setScore(utl::clone(_newScore));
+                    _strScores[i]->copyScore(_newScore);
                     int globalCmpResult = objective->compare(_newScore, _bestScore);
                     _sameScore = (globalCmpResult == 0);
                     _newBest = (globalCmpResult > 0);
@@ -123,8 +123,8 @@ MultistartHC::run()
                     {
                         _improvementIteration = _iteration;
                         rop->addSuccessIter();
-                        setBestScore(utl::clone(_newScore));
-                        objective->setBestScore(utl::clone(_bestScore));
+                        copyBestScore(_newScore);
+                        objective->copyBestScore(_bestScore);
                     }
                 }
             }
@@ -80,10 +80,7 @@ MultistartSA::run()
 
     while (!complete)
     {
-        // halve _beamWidth at 5%, 25%, and 100% of min-iterations
-        if (_iteration == roundUp(_minIterations / 20, _beamWidth) || //   5%
-            _iteration == roundUp(_minIterations / 4, _beamWidth) ||  //  25%
-            _iteration == roundUp(_minIterations, _beamWidth))        // 100%
+        if (halveBeam())
         {
             std::sort(_strScores.begin(), _strScores.end(), StringScoreOrdering());
             _beamWidth = utl::max((uint_t)1, (_beamWidth / 2));
@@ -116,7 +113,7 @@ MultistartSA::run()
 
             // generate a schedule
             iterationRun(rop);
-            setAcceptedScore(utl::clone(acceptedScores(_strScores[i]->getId())));
+            copyScore(_acceptedScore, acceptedScores(_strScores[i]->getId()));
             auto diff = objective->scoreDiff(_newScore, _acceptedScore);
             auto acceptProb = exp(diff / _currentTemp);
             _accept = (_rng->uniform(0.0, 1.0) < acceptProb); //_accept
@@ -127,8 +124,8 @@ MultistartSA::run()
             if (_accept)
             {
                 rop->accept();
-                setAcceptedScore(_strScores[i]->getId(), utl::clone(_newScore));
-                _strScores[i]->setScore(utl::clone(_newScore));
+                acceptedScores(_strScores[i]->getId())->copy(*_newScore);
+                _strScores[i]->copyScore(_newScore);
                 int globalCmpResult = objective->compare(_newScore, _bestScore);
                 _sameScore = (globalCmpResult == 0);
                 _newBest = (globalCmpResult > 0);
@@ -136,10 +133,10 @@ MultistartSA::run()
                 {
                     rop->addSuccessIter();
                     _improvementIteration = _iteration;
-                    setBestScore(utl::clone(_newScore));
-                    _bestStrScore->setScore(utl::clone(_newScore));
-                    _bestStrScore->setString(utl::clone(_ind->stringPtr()));
-                    objective->setBestScore(utl::clone(_bestScore));
+                    copyBestScore(_newScore);
+                    _bestStrScore->copyScore(_newScore);
+                    _bestStrScore->copyString(_ind->string());
+                    objective->copyBestScore(_bestScore);
                 }
             }
             else
@@ -147,7 +144,15 @@ MultistartSA::run()
                 rop->undo();
             }
 
-            _currentTemp = (double)pow(_tempDcrRate, (int)(_iteration / 100)) * _initTemp;
+            if (timeBudgeted())
+            {
+                _currentTemp =
+                    (double)pow(_tempDcrRate, (int)timeBudgetTempSteps(100)) * _initTemp;
+            }
+            else
+            {
+                _currentTemp = (double)pow(_tempDcrRate, (int)(_iteration / 100)) * _initTemp;
+            }
 #ifdef DEBUG_UNIT
             utl::cout << "startId:" << _strScores[i]->getId() << "(" << i << "/" << _beamWidth
                       << ", " << Float(_strScores[i]->getScore()->getValue()).toString(0) << "), "
@@ -200,23 +205,35 @@ MultistartSA::setAcceptedScore(Score* score)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void
-MultistartSA::setAcceptedScore(uint_t idx, Score* score)
+Score*
+MultistartSA::acceptedScores(uint_t idx)
 {
     auto it = _acceptedScoresMap.find(idx);
     ASSERTD(it != _acceptedScoresMap.end());
-    delete (*it).second;
-    (*it).second = score;
+    return (*it).second;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Score*
-MultistartSA::acceptedScores(uint_t idx)
+bool
+MultistartSA::halveBeam()
 {
-    auto it = _acceptedScoresMap.find(idx);
-    ASSERTD(it != _acceptedScoresMap.end());
-    return (*it).second;
+    // halve _beamWidth at 5%, 25%, and 100% of min-iterations
+    if (!timeBudgeted())
+    {
+        return (_iteration == roundUp(_minIterations / 20, _beamWidth) || //   5%
+                _iteration == roundUp(_minIterations / 4, _beamWidth) ||  //  25%
+                _iteration == roundUp(_minIterations, _beamWidth));       // 100%
+    }
+
+    // time-budgeted: halve _beamWidth at 5%, 25%, and 50% of the elapsed budget
+    static const double halvingFractions[] = {0.05, 0.25, 0.5};
+    if ((_numHalvings == 3) || (elapsedFraction() < halvingFractions[_numHalvings]))
+    {
+        return false;
+    }
+    ++_numHalvings;
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,6 +242,7 @@ void
 MultistartSA::init()
 {
     _beamWidth = 0;
+    _numHalvings = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
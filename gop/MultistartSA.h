@@ -43,11 +43,12 @@ private:
     void init();
     void deInit();
     virtual void setAcceptedScore(Score* score);
-    virtual void setAcceptedScore(uint_t idx, Score* score);
     virtual Score* acceptedScores(uint_t idx);
+    bool halveBeam();
 
 private:
     uint_t _beamWidth;
+    uint_t _numHalvings;
     stringscore_vector_t _strScores;
     uint_score_map_t _acceptedScoresMap;
 };
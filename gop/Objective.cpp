@@ -59,6 +59,23 @@ Objective::setBestScore(Score* bestScore)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Objective::copyBestScore(const Score* bestScore)
+{
+    if (_bestScore == nullptr)
+    {
+        _bestScore = bestScore->clone();
+    }
+    else
+    {
+        _bestScore->copy(*bestScore);
+    }
+    ASSERTD(_indEvaluator != nullptr);
+    _bestScoreComponents = _indEvaluator->componentScores();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 int
 Objective::getBestScoreComponent(const std::string& componentName) const
 {
@@ -109,6 +126,15 @@ Objective::eval(IndBuilderContext* context) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Objective::eval(IndBuilderContext* context, Score& score) const
+{
+    ASSERTD(_indEvaluator != nullptr);
+    _indEvaluator->eval(context, score);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 int
 Objective::compare(Score* lhs, Score* rhs) const
 {
@@ -100,6 +100,9 @@ public:
     /** Set the best score. */
     void setBestScore(Score* bestScore);
 
+    /** Set the best score (by copying into the existing Score object). */
+    void copyBestScore(const Score* bestScore);
+
     /** Get a best score component. */
     int getBestScoreComponent(const std::string& componentName) const;
 
@@ -115,6 +118,9 @@ public:
     /** Evaluate the given individual. */
     Score* eval(IndBuilderContext* context) const;
 
+    /** Evaluate the given individual into an existing Score object. */
+    void eval(IndBuilderContext* context, Score& score) const;
+
     /**
        Compare two scores.
        \return -1 if lhs is worse than rhs, 
@@ -3,6 +3,10 @@
 #include <libutl/Float.h>
 #include <libutl/Duration.h>
 #include "Optimizer.h"
+#undef new
+#include <chrono>
+#include <time.h>
+#include <libutl/gblnew_macros.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -25,11 +29,38 @@ GOP_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/** Wall-clock time (in seconds). */
+static double
+wallTime()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(now).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** CPU time used by the calling thread (in seconds). */
+static double
+threadCPUtime()
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+    {
+        return 0.0;
+    }
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool
 Optimizer::complete() const
 {
     if (_iteration == 0)
         return false;
+    // time budget is spent -> complete even if _iteration < _minIterations
+    if (timeBudgeted() && (timeFraction() >= 1.0))
+        return true;
     if (_iteration < _minIterations)
         return false;
     if (_iteration >= _maxIterations)
@@ -49,6 +80,19 @@ Optimizer::stop()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+Optimizer::setDeadline(uint_t deadline)
+{
+    double elapsed = (wallTime() - _startWallTime) * 1000.0;
+    double wallTimeLimit = elapsed + deadline;
+    if (wallTimeLimit < _wallTimeLimit)
+    {
+        _wallTimeLimit = (uint_t)wallTimeLimit;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 static time_t startTime;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +108,11 @@ Optimizer::initialize(const OptimizerConfiguration* config)
     _improvementGap = config->improvementGap();
     if (_improvementGap == 0)
         _improvementGap = 1;
+    _wallTimeLimit = config->wallTimeLimit();
+    _cpuTimeLimit = config->cpuTimeLimit();
+    _startWallTime = wallTime();
+    _cpuThread = std::thread::id();
+    _startCPUtime = 0.0;
     delete _ind;
     _ind = lut::clone(config->ind());
     delete _indBuilder;
@@ -83,6 +132,19 @@ Optimizer::initialize(const OptimizerConfiguration* config)
     _indBuilder->initialize(config->dataSet());
     initializeObjectives();
     initializeOps(config->ind());
+
+    // the score cache remembers the first objective's score only
+    delete _scoreCache;
+    _scoreCache = nullptr;
+    if ((config->scoreCacheSize() != 0) && (_objectives.size() == 1))
+    {
+        _scoreCache = new ScoreCache(config->scoreCacheSize());
+    }
+
+    // score bounds are for the first objective, and only a minimized score has a lower bound
+    _scoreBounding = config->scoreBounding() && (_objectives.size() == 1) &&
+                     _objectives[0]->minimize();
+    _scoreBound = utl::double_t_max;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,11 +157,39 @@ Optimizer::iterationRun(Operator* op, bool audit)
     ASSERTD(_context != nullptr);
 
     Objective* objective = _objectives[0];
+    bool useCache = (_scoreCache != nullptr) && (op != nullptr) && !audit;
+    double bound = _scoreBound;
+    bool bounded = (bound != utl::double_t_max) && (op != nullptr) && !audit;
+    _scoreBound = utl::double_t_max;
+    bool hashed = false;
+    uint64_t hash = 0;
     try
     {
         _context->clear();
         if (op)
             op->execute(_ind, _context, _singleStep);
+
+        // string was scored recently -> don't construct it
+        if (useCache)
+        {
+            hash = _ind->string().hash();
+            hashed = true;
+            if (_newScore == nullptr)
+            {
+                _newScore = new Score();
+            }
+            if (_scoreCache->find(hash, *_newScore))
+            {
+                _fail = (_newScore->getType() == score_failed);
+                return !_fail;
+            }
+        }
+
+        // construction may be abandoned once it can't meet the score bound
+        if (bounded)
+        {
+            _context->setScoreBound(objective->indEvaluator(), bound);
+        }
         _indBuilder->run(_ind, _context);
         _fail = false;
     }
@@ -115,7 +205,20 @@ Optimizer::iterationRun(Operator* op, bool audit)
         objective->indEvaluator()->auditNext();
     }
 
-    setNewScore(objective->eval(_context));
+    // evaluate into _newScore (re-using it across iterations)
+    if (_newScore == nullptr)
+    {
+        _newScore = new Score();
+    }
+    objective->eval(_context, *_newScore);
+    _context->clearScoreBound();
+
+    // remember the score (unless the ind-builder changed the string, or abandoned it)
+    if (hashed && (_ind->newString() == nullptr) && !_context->pruned())
+    {
+        _scoreCache->add(hash, _newScore);
+    }
+
     return ((_newScore->getType() == score_succeeded) ||
             (_newScore->getType() == score_ct_violated));
 }
@@ -126,6 +229,62 @@ void
 Optimizer::updateRunStatus(bool complete)
 {
     _runStatus->update(complete, _iteration, _improvementIteration, _bestScore);
+    if (_scoreCache != nullptr)
+    {
+        _runStatus->updateScoreCache(_scoreCache->numLookups(), _scoreCache->numHits());
+    }
+    if (_context != nullptr)
+    {
+        _context->updateRunStatus(_runStatus);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+Optimizer::elapsedFraction() const
+{
+    double fraction = timeFraction();
+    if (_maxIterations != uint_t_max)
+    {
+        fraction = utl::max(fraction, (double)_iteration / _maxIterations);
+    }
+    return utl::min(fraction, 1.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+Optimizer::timeFraction() const
+{
+    double fraction = 0.0;
+    if (_wallTimeLimit != uint_t_max)
+    {
+        double elapsed = (wallTime() - _startWallTime) * 1000.0;
+        fraction = utl::max(fraction, elapsed / utl::max(_wallTimeLimit, (uint_t)1));
+    }
+    if (_cpuTimeLimit != uint_t_max)
+    {
+        double elapsed = cpuTime() * 1000.0;
+        fraction = utl::max(fraction, elapsed / utl::max(_cpuTimeLimit, (uint_t)1));
+    }
+    return fraction;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+Optimizer::cpuTime() const
+{
+    // the run may be executed by a different thread than the one that initialized it
+    // -> count the CPU time of the thread that checks the time budget, from its first check
+    auto threadId = std::this_thread::get_id();
+    if (threadId != _cpuThread)
+    {
+        _cpuThread = threadId;
+        _startCPUtime = threadCPUtime();
+    }
+    return (threadCPUtime() - _startCPUtime) + workersCPUtime();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,7 +579,14 @@ Optimizer::init()
     _minIterations = uint_t_max;
     _maxIterations = uint_t_max;
     _improvementGap = uint_t_max;
+    _wallTimeLimit = uint_t_max;
+    _cpuTimeLimit = uint_t_max;
+    _startWallTime = 0.0;
+    _startCPUtime = 0.0;
     _runStatus = new RunStatus();
+    _scoreCache = nullptr;
+    _scoreBounding = false;
+    _scoreBound = utl::double_t_max;
     _initScore = nullptr;
     _bestScore = nullptr;
     _newScore = nullptr;
@@ -440,6 +606,7 @@ Optimizer::deInit()
 {
     delete _rng;
     delete _runStatus;
+    delete _scoreCache;
     delete _ind;
     delete _indBuilder;
     delete _initScore;
@@ -8,7 +8,11 @@
 #include <gop/IndEvaluator.h>
 #include <gop/Population.h>
 #include <gop/RunStatus.h>
+#include <gop/ScoreCache.h>
 #include <gop/Score.h>
+#undef new
+#include <thread>
+#include <libutl/gblnew_macros.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +43,14 @@ public:
     /** Stop the run. */
     void stop();
 
+    /**
+       Set a hard deadline for the run.
+       The run is complete when the deadline passes (the wall-clock time limit is reduced
+       accordingly).
+       \param deadline deadline (in milliseconds from now)
+    */
+    void setDeadline(uint_t deadline);
+
     /**
        Initialize.
        \param config configuration
@@ -52,7 +64,13 @@ public:
     */
     virtual bool run() = 0;
 
-    /** Iteration run: run just one iteration. */
+    /**
+       Iteration run: run just one iteration.
+       If the score cache is enabled (see OptimizerConfiguration::scoreCacheSize) and the string
+       produced by \b op was scored recently, the remembered score is used and the individual
+       isn't constructed (so the context doesn't hold its schedule).  The cache is never used for
+       an audit run.
+    */
     virtual bool iterationRun(Operator* op = nullptr, bool audit = false);
 
     virtual void updateRunStatus(bool complete);
@@ -152,6 +170,49 @@ protected:
     void initializeObjectives();
     void initializeOps(StringInd<uint_t>* ind = nullptr);
 
+    /** Is the run limited by a wall-clock or CPU time budget? */
+    bool
+    timeBudgeted() const
+    {
+        return (_wallTimeLimit != uint_t_max) || (_cpuTimeLimit != uint_t_max);
+    }
+
+    /**
+       Get the fraction of the run that has elapsed, according to whichever budget (iterations,
+       wall-clock time, CPU time) is being spent fastest.
+    */
+    double elapsedFraction() const;
+
+    /** Get the fraction of the time budget that has elapsed (0 if there's no time budget). */
+    double timeFraction() const;
+
+    /**
+       Get the CPU time used by the run (in seconds): the CPU time of the thread that executes the
+       run (since its first check of the time budget), and that of the worker threads.
+    */
+    double cpuTime() const;
+
+    /** Get the CPU time used by the worker threads (in seconds). */
+    virtual double
+    workersCPUtime() const
+    {
+        return 0.0;
+    }
+
+    /**
+       Set the score bound for the next iterationRun() (ignored unless score-bounding is
+       enabled, see OptimizerConfiguration::scoreBounding).
+       \param bound worst score (of the first objective) that could be accepted
+    */
+    void
+    setScoreBound(double bound)
+    {
+        if (_scoreBounding)
+        {
+            _scoreBound = bound;
+        }
+    }
+
     /** Choose an operator randomly for multiple step move in a direction. */
     Operator* chooseRandomOp() const;
 
@@ -187,6 +248,34 @@ protected:
         _newScore = score;
     }
 
+    /** Copy a score into _bestScore (re-using the existing Score object). */
+    void
+    copyBestScore(const Score* score)
+    {
+        copyScore(_bestScore, score);
+    }
+
+    /** Copy a score into _newScore (re-using the existing Score object). */
+    void
+    copyNewScore(const Score* score)
+    {
+        copyScore(_newScore, score);
+    }
+
+    /** Copy rhs into lhs (cloning rhs if lhs doesn't exist yet). */
+    static void
+    copyScore(Score*& lhs, const Score* rhs)
+    {
+        if (lhs == nullptr)
+        {
+            lhs = rhs->clone();
+        }
+        else
+        {
+            lhs->copy(*rhs);
+        }
+    }
+
 protected:
     // misc
     mutable lut::rng_t* _rng;
@@ -195,10 +284,18 @@ protected:
     uint_t _minIterations;
     uint_t _maxIterations;
     uint_t _improvementGap;
+    uint_t _wallTimeLimit;
+    uint_t _cpuTimeLimit;
+    double _startWallTime;
+    mutable std::thread::id _cpuThread;
+    mutable double _startCPUtime;
     StringInd<uint_t>* _ind;
     IndBuilder* _indBuilder;
     IndBuilderContext* _context;
     RunStatus* _runStatus;
+    ScoreCache* _scoreCache;
+    bool _scoreBounding;
+    double _scoreBound;
     bool _singleStep;
 
     // iteration status
@@ -1,4 +1,5 @@
 #include "libgop.h"
+#include "ConfigEx.h"
 #include "OptimizerConfiguration.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +17,11 @@ GOP_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// serialization format version (see OptimizerConfiguration)
+static const uint_t formatVersion = 5;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 OptimizerConfiguration::clear()
 {
@@ -32,7 +38,13 @@ OptimizerConfiguration::copy(const Object& rhs)
     _minIterations = cf._minIterations;
     _maxIterations = cf._maxIterations;
     _improvementGap = cf._improvementGap;
-    setInd(cf.ind());
+    _numThreads = cf._numThreads;
+    _scoreCacheSize = cf._scoreCacheSize;
+    _wallTimeLimit = cf._wallTimeLimit;
+    _cpuTimeLimit = cf._cpuTimeLimit;
+    _scoreBounding = cf._scoreBounding;
+    _coolingSchedule = cf._coolingSchedule;
+    setInd(lut::clone(cf._ind));
     setIndBuilder(lut::clone(cf._indBuilder));
     _context = cf._context;
     copyVector(_objectives, cf._objectives);
@@ -44,6 +56,13 @@ OptimizerConfiguration::copy(const Object& rhs)
 void
 OptimizerConfiguration::serialize(Stream& stream, uint_t io, uint_t)
 {
+    // the format version comes first
+    uint_t version = formatVersion;
+    utl::serialize(version, stream, io);
+    if (version > formatVersion)
+    {
+        throw ConfigEx();
+    }
     if (io == io_rd)
     {
         deleteCont(_objectives);
@@ -55,6 +74,31 @@ OptimizerConfiguration::serialize(Stream& stream, uint_t io, uint_t)
     utl::serialize(_indBuilder, stream, io, ser_default);
     lut::serialize(_objectives, stream, io);
     lut::serialize(_ops, stream, io);
+    if (version >= 1)
+    {
+        utl::serialize(_numThreads, stream, io);
+    }
+    if (version >= 2)
+    {
+        utl::serialize(_scoreCacheSize, stream, io);
+    }
+    if (version >= 3)
+    {
+        utl::serialize(_wallTimeLimit, stream, io);
+        utl::serialize(_cpuTimeLimit, stream, io);
+    }
+    if (version >= 4)
+    {
+        utl::serialize(_scoreBounding, stream, io);
+    }
+    if (version >= 5)
+    {
+        utl::serialize((uint_t&)_coolingSchedule, stream, io);
+    }
+    if ((io == io_rd) && (_coolingSchedule >= cooling_undefined))
+    {
+        throw ConfigEx();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -65,6 +109,12 @@ OptimizerConfiguration::init()
     _minIterations = uint_t_max;
     _maxIterations = uint_t_max;
     _improvementGap = uint_t_max;
+    _numThreads = 1;
+    _scoreCacheSize = 0;
+    _wallTimeLimit = uint_t_max;
+    _cpuTimeLimit = uint_t_max;
+    _scoreBounding = false;
+    _coolingSchedule = cooling_geometric;
     _ind = nullptr;
     _indBuilder = nullptr;
     _context = nullptr;
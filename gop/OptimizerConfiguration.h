@@ -14,11 +14,37 @@ GOP_NS_BEGIN;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+   Cooling schedule (for simulated annealing).
+
+   \see SAoptimizer
+   \ingroup gop
+*/
+enum cooling_schedule_t
+{
+    cooling_geometric = 0, /**< reduce the temperature by a fixed rate */
+    cooling_lam = 1,       /**< set the temperature for Lam-Delosme's target acceptance rate */
+    cooling_feedback = 2,  /**< adjust the temperature by the acceptance rate's error */
+    cooling_undefined = 3
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /**
    Optimizer configuration.
 
    OptimizerConfiguration stores optimizer configuration parameters.
 
+   A serialized OptimizerConfiguration begins with its format version, so a stream in an older
+   format can still be read (the settings that were added since keep their default values):
+
+   - 0 : original format
+   - 1 : adds numThreads
+   - 2 : adds scoreCacheSize
+   - 3 : adds wallTimeLimit and cpuTimeLimit
+   - 4 : adds scoreBounding
+   - 5 : adds coolingSchedule
+
    \ingroup gop
 */
 
@@ -61,6 +87,71 @@ public:
         return _improvementGap;
     }
 
+    /**
+       Get the wall-clock time limit (in milliseconds).
+       The run is complete when this much time has elapsed since Optimizer::initialize (even if
+       minIterations() haven't been done).  uint_t_max means no limit.
+    */
+    uint_t
+    wallTimeLimit() const
+    {
+        return _wallTimeLimit;
+    }
+
+    /**
+       Get the CPU time limit (in milliseconds).
+       The run is complete when it has used this much CPU time: the CPU time of the thread that
+       executes it, and of the optimizer's worker threads (see Optimizer::cpuTime).  Other
+       processes and runs aren't counted.  uint_t_max means no limit.
+    */
+    uint_t
+    cpuTimeLimit() const
+    {
+        return _cpuTimeLimit;
+    }
+
+    /**
+       Get the number of threads.
+       Optimizers that evaluate several individuals at once (e.g. GAoptimizer) construct them
+       on this many threads.
+    */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
+
+    /**
+       Get the score cache size.
+       If non-zero, Optimizer::iterationRun remembers the scores of this many recently
+       constructed strings (see ScoreCache), and doesn't re-construct a remembered string.
+    */
+    uint_t
+    scoreCacheSize() const
+    {
+        return _scoreCacheSize;
+    }
+
+    /**
+       Abandon constructions that can't be accepted?
+       If true, optimizers that know their acceptance threshold before constructing an individual
+       (e.g. HillClimber, SAoptimizer) stop constructing it as soon as the objective's lower
+       bound on its score exceeds the threshold (see IndEvaluator::scoreLowerBound).  The
+       abandoned individual is scored as a failure.
+    */
+    bool
+    scoreBounding() const
+    {
+        return _scoreBounding;
+    }
+
+    /** Get the cooling schedule (for simulated annealing). */
+    cooling_schedule_t
+    coolingSchedule() const
+    {
+        return _coolingSchedule;
+    }
+
     /** Get the individual (StringInd<uint_t>). */
     gop::StringInd<uint_t>*
     ind() const
@@ -127,6 +218,48 @@ public:
         _improvementGap = improvementGap;
     }
 
+    /** Set the wall-clock time limit (in milliseconds). */
+    void
+    setWallTimeLimit(uint_t wallTimeLimit)
+    {
+        _wallTimeLimit = wallTimeLimit;
+    }
+
+    /** Set the CPU time limit (in milliseconds). */
+    void
+    setCPUtimeLimit(uint_t cpuTimeLimit)
+    {
+        _cpuTimeLimit = cpuTimeLimit;
+    }
+
+    /** Set the number of threads. */
+    void
+    setNumThreads(uint_t numThreads)
+    {
+        _numThreads = numThreads;
+    }
+
+    /** Set the score cache size. */
+    void
+    setScoreCacheSize(uint_t scoreCacheSize)
+    {
+        _scoreCacheSize = scoreCacheSize;
+    }
+
+    /** Set the score-bounding flag. */
+    void
+    setScoreBounding(bool scoreBounding)
+    {
+        _scoreBounding = scoreBounding;
+    }
+
+    /** Set the cooling schedule. */
+    void
+    setCoolingSchedule(cooling_schedule_t coolingSchedule)
+    {
+        _coolingSchedule = coolingSchedule;
+    }
+
     /** Set the individual (StringInd<uint_t>). */
     void
     setInd(gop::StringInd<uint_t>* ind)
@@ -183,6 +316,12 @@ private:
     uint_t _minIterations;
     uint_t _maxIterations;
     uint_t _improvementGap;
+    uint_t _numThreads;
+    uint_t _scoreCacheSize;
+    uint_t _wallTimeLimit;
+    uint_t _cpuTimeLimit;
+    bool _scoreBounding;
+    cooling_schedule_t _coolingSchedule;
     StringInd<uint_t>* _ind;
     IndBuilder* _indBuilder;
     IndBuilderContext* _context;
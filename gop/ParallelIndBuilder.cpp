@@ -0,0 +1,124 @@
+#include "libgop.h"
+#include "ParallelIndBuilder.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ParallelIndBuilder::ParallelIndBuilder()
+{
+    _threadPool = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ParallelIndBuilder::~ParallelIndBuilder()
+{
+    clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParallelIndBuilder::initialize(const OptimizerConfiguration* config,
+                               IndBuilderContext* context,
+                               IndBuilder* indBuilder,
+                               Objective* objective,
+                               const StringInd<uint_t>* ind,
+                               rng_t* rng)
+{
+    clear();
+
+    // thread 0 uses the optimizer's context, ind-builder and objective
+    _workers.push_back(Worker{context, indBuilder, objective});
+
+    // make the other workers (if the context can make worker contexts)
+    uint_t numThreads = utl::max(config->numThreads(), (uint_t)1);
+    while (_workers.size() < numThreads)
+    {
+        auto workerContext = context->makeWorkerContext();
+        if (workerContext == nullptr)
+        {
+            break;
+        }
+        auto workerIndBuilder = lut::clone(config->indBuilder());
+        workerIndBuilder->initialize(workerContext->dataSet());
+        auto workerObjective = lut::clone(objective);
+
+        // construct an individual once, so the ind-builder is in the same state as the optimizer's
+        auto workerInd = lut::clone(ind);
+        workerIndBuilder->initializeInd(workerInd, workerContext->dataSet(), rng);
+        try
+        {
+            workerContext->clear();
+            workerIndBuilder->run(workerInd, workerContext);
+        }
+        catch (...)
+        {
+        }
+        delete workerInd;
+
+        _workers.push_back(Worker{workerContext, workerIndBuilder, workerObjective});
+    }
+    _threadPool = new ThreadPool(_workers.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParallelIndBuilder::run(stringind_vector_t& inds, score_vector_t& scores, uint_t numInds)
+{
+    ASSERTD(_threadPool != nullptr);
+    _threadPool->run(numInds, [&](uint_t indIdx, uint_t threadIdx) {
+        auto& worker = _workers[threadIdx];
+        auto ind = inds[indIdx];
+        try
+        {
+            worker.context->clear();
+            worker.indBuilder->run(ind, worker.context);
+        }
+        catch (...)
+        {
+            worker.context->setFailed();
+        }
+        if (ind->newString() != nullptr)
+        {
+            ind->acceptNewString();
+        }
+        if (scores[indIdx] == nullptr)
+        {
+            scores[indIdx] = new Score();
+        }
+        worker.objective->eval(worker.context, *scores[indIdx]);
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParallelIndBuilder::clear()
+{
+    delete _threadPool;
+    _threadPool = nullptr;
+
+    // worker 0 belongs to the optimizer
+    for (uint_t i = 1; i < _workers.size(); ++i)
+    {
+        auto& worker = _workers[i];
+        delete worker.indBuilder;
+        delete worker.context;
+        delete worker.objective;
+    }
+    _workers.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
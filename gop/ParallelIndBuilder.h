@@ -0,0 +1,103 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <lut/ThreadPool.h>
+#include <gop/IndBuilder.h>
+#include <gop/Objective.h>
+#include <gop/OptimizerConfiguration.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** A \c std::vector of StringInd<uint_t> pointers. */
+using stringind_vector_t = std::vector<StringInd<uint_t>*>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Construct and evaluate several individuals at once, on multiple threads.
+
+   Each thread has its own IndBuilderContext (see IndBuilderContext::makeWorkerContext),
+   IndBuilder and Objective.  Thread 0 (the calling thread) uses the optimizer's own context,
+   ind-builder and objective.  If the optimizer's context can't make worker contexts, only
+   thread 0 is used.
+
+   The IndBuilder must construct individuals from their strings alone (as the cse sequence
+   selectors do), because the individuals are constructed in contexts where no operator has
+   executed.
+
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ParallelIndBuilder
+{
+public:
+    /** Constructor. */
+    ParallelIndBuilder();
+
+    /** Destructor. */
+    ~ParallelIndBuilder();
+
+    /**
+       Initialize.
+       \param config optimizer configuration (provides the number of threads)
+       \param context optimizer's context (used by thread 0)
+       \param indBuilder optimizer's (initialized) ind-builder (used by thread 0)
+       \param objective optimizer's objective (used by thread 0)
+       \param ind optimizer's (initialized and constructed) individual
+       \param rng optimizer's PRNG
+    */
+    void initialize(const OptimizerConfiguration* config,
+                    IndBuilderContext* context,
+                    IndBuilder* indBuilder,
+                    Objective* objective,
+                    const StringInd<uint_t>* ind,
+                    lut::rng_t* rng);
+
+    /** Get the number of threads. */
+    uint_t
+    numThreads() const
+    {
+        return _workers.size();
+    }
+
+    /** Get the CPU time used by the worker threads (in seconds, not counting thread 0). */
+    double
+    cpuTime() const
+    {
+        return (_threadPool == nullptr) ? 0.0 : _threadPool->cpuTime();
+    }
+
+    /**
+       Construct and evaluate individuals.
+       \param inds individuals to construct
+       \param scores (out) scores (scores[i] is replaced with the score of inds[i])
+       \param numInds number of individuals (from the beginning of inds)
+    */
+    void run(stringind_vector_t& inds, score_vector_t& scores, uint_t numInds);
+
+private:
+    struct Worker
+    {
+        IndBuilderContext* context;
+        IndBuilder* indBuilder;
+        Objective* objective;
+    };
+
+private:
+    void clear();
+
+private:
+    std::vector<Worker> _workers;
+    lut::ThreadPool* _threadPool;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -0,0 +1,109 @@
+#include "libgop.h"
+#include "ParallelObjectiveEvaluator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ParallelObjectiveEvaluator::ParallelObjectiveEvaluator()
+{
+    _threadPool = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ParallelObjectiveEvaluator::~ParallelObjectiveEvaluator()
+{
+    clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParallelObjectiveEvaluator::initialize(uint_t numThreads)
+{
+    clear();
+    if (numThreads > 1)
+    {
+        _threadPool = new ThreadPool(numThreads);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParallelObjectiveEvaluator::run(IndBuilderContext* context,
+                                const objective_vector_t& objectives,
+                                score_vector_t& scores,
+                                uint_t begin)
+{
+    uint_t numObjectives = objectives.size();
+    ASSERTD(scores.size() >= numObjectives);
+    if (begin >= numObjectives)
+    {
+        return;
+    }
+
+    // make the scores before any task runs (tasks only write to their own score)
+    for (uint_t i = begin; i != numObjectives; ++i)
+    {
+        if (scores[i] == nullptr)
+        {
+            scores[i] = new Score();
+        }
+    }
+
+    // only one objective (or one thread) -> evaluate it here
+    uint_t numTasks = numObjectives - begin;
+    if ((numTasks == 1) || (_threadPool == nullptr))
+    {
+        for (uint_t i = begin; i != numObjectives; ++i)
+        {
+            objectives[i]->eval(context, *scores[i]);
+        }
+        return;
+    }
+
+    // evaluate the independent objectives in parallel, then the ones that share state
+    uint_vector_t parallelObjectives;
+    uint_vector_t serialObjectives;
+    for (uint_t i = begin; i != numObjectives; ++i)
+    {
+        if (objectives[i]->indEvaluator()->sharesState())
+        {
+            serialObjectives.push_back(i);
+        }
+        else
+        {
+            parallelObjectives.push_back(i);
+        }
+    }
+    _threadPool->run(parallelObjectives.size(), [&](uint_t taskIdx, uint_t) {
+        uint_t i = parallelObjectives[taskIdx];
+        objectives[i]->eval(context, *scores[i]);
+    });
+    for (auto i : serialObjectives)
+    {
+        objectives[i]->eval(context, *scores[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParallelObjectiveEvaluator::clear()
+{
+    delete _threadPool;
+    _threadPool = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
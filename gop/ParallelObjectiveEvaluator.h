@@ -0,0 +1,72 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <lut/ThreadPool.h>
+#include <gop/Objective.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Evaluate several objectives for the same constructed individual, on multiple threads.
+
+   Once an individual has been constructed, its context isn't modified until the next
+   construction begins, and each Objective has its own IndEvaluator, so the objectives are
+   independent of each other: each one is evaluated by its own task.  If there's only one
+   objective to evaluate (or only one thread), it's evaluated by the calling thread.  Objectives
+   whose evaluators modify shared state (see IndEvaluator::sharesState) are evaluated by the calling
+   thread, one after another, once the other objectives have been evaluated.
+
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ParallelObjectiveEvaluator
+{
+public:
+    /** Constructor. */
+    ParallelObjectiveEvaluator();
+
+    /** Destructor. */
+    ~ParallelObjectiveEvaluator();
+
+    /**
+       Initialize.
+       \param numThreads number of threads (including the calling thread)
+    */
+    void initialize(uint_t numThreads);
+
+    /** Get the number of threads. */
+    uint_t
+    numThreads() const
+    {
+        return (_threadPool == nullptr) ? 1 : _threadPool->numThreads();
+    }
+
+    /**
+       Evaluate objectives.
+       \param context context that holds the constructed individual
+       \param objectives objectives
+       \param scores (out) scores (scores[i] is replaced with the score for objectives[i])
+       \param begin index of the first objective to evaluate
+    */
+    void run(IndBuilderContext* context,
+             const objective_vector_t& objectives,
+             score_vector_t& scores,
+             uint_t begin = 0);
+
+private:
+    void clear();
+
+private:
+    lut::ThreadPool* _threadPool;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -0,0 +1,215 @@
+#include "libgop.h"
+#include "ParetoArchive.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(gop::ParetoArchive);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ParetoArchive::ParetoArchive(uint_t capacity, const objective_vector_t& objectives)
+{
+    init();
+    ASSERTD(capacity >= 2);
+    _capacity = capacity;
+    _objectives = objectives;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoArchive::clear()
+{
+    _mutex.lock();
+    deleteCont(_inds);
+    _mutex.unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ParetoArchive::add(const StringInd<uint_t>& ind)
+{
+    ASSERTD(ind.numScores() == numObjectives());
+    if (dominated(ind))
+    {
+        return false;
+    }
+
+    _mutex.lock();
+
+    // evict the members that ind dominates
+    auto it = std::remove_if(_inds.begin(), _inds.end(), [&](StringInd<uint_t>* member) {
+        if (!ind.dominates(member, _objectives))
+        {
+            return false;
+        }
+        delete member;
+        return true;
+    });
+    _inds.erase(it, _inds.end());
+
+    // add ind
+    _inds.push_back(ind.clone());
+
+    // over capacity -> evict the most crowded member
+    if (_inds.size() > _capacity)
+    {
+        uint_t idx = mostCrowded();
+        delete _inds[idx];
+        _inds.erase(_inds.begin() + idx);
+    }
+
+    _mutex.unlock();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ParetoArchive::dominated(const Ind& ind) const
+{
+    for (auto member : _inds)
+    {
+        if (member->dominates(&ind, _objectives) || equivalent(*member, ind))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ParetoArchive::getRange(uint_t objectiveIdx, double& minScore, double& maxScore) const
+{
+    if (_inds.empty())
+    {
+        return false;
+    }
+    minScore = maxScore = _inds.front()->getScore(objectiveIdx);
+    for (auto member : _inds)
+    {
+        double score = member->getScore(objectiveIdx);
+        minScore = utl::min(minScore, score);
+        maxScore = utl::max(maxScore, score);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoArchive::getScores(std::vector<double>& scores) const
+{
+    _mutex.lock();
+    scores.clear();
+    uint_t numObjectives = this->numObjectives();
+    for (auto member : _inds)
+    {
+        for (uint_t i = 0; i != numObjectives; ++i)
+        {
+            scores.push_back(member->getScore(i));
+        }
+    }
+    _mutex.unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoArchive::init()
+{
+    _capacity = 100;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoArchive::deInit()
+{
+    deleteCont(_inds);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ParetoArchive::equivalent(const Ind& lhs, const Ind& rhs) const
+{
+    uint_t numObjectives = this->numObjectives();
+    for (uint_t i = 0; i != numObjectives; ++i)
+    {
+        if (_objectives[i]->compare(lhs.getScore(i), rhs.getScore(i)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+ParetoArchive::mostCrowded()
+{
+    uint_t numInds = _inds.size();
+    uint_t numObjectives = this->numObjectives();
+    _distances.assign(numInds, 0.0);
+    _order.resize(numInds);
+
+    // crowding distance: sum (over objectives) of the normalized distance between neighbors
+    for (uint_t j = 0; j != numObjectives; ++j)
+    {
+        for (uint_t i = 0; i != numInds; ++i)
+        {
+            _order[i] = i;
+        }
+        std::sort(_order.begin(), _order.end(), [&](uint_t lhs, uint_t rhs) {
+            return (_inds[lhs]->getScore(j) < _inds[rhs]->getScore(j));
+        });
+        double minScore = _inds[_order.front()]->getScore(j);
+        double maxScore = _inds[_order.back()]->getScore(j);
+        _distances[_order.front()] = double_t_max;
+        _distances[_order.back()] = double_t_max;
+        if (maxScore == minScore)
+        {
+            continue;
+        }
+        for (uint_t k = 1; k < (numInds - 1); ++k)
+        {
+            auto& distance = _distances[_order[k]];
+            if (distance == double_t_max)
+            {
+                continue;
+            }
+            double prevScore = _inds[_order[k - 1]]->getScore(j);
+            double nextScore = _inds[_order[k + 1]]->getScore(j);
+            distance += (nextScore - prevScore) / (maxScore - minScore);
+        }
+    }
+
+    // find the member with the smallest crowding distance
+    uint_t minIdx = 0;
+    for (uint_t i = 1; i != numInds; ++i)
+    {
+        if (_distances[i] < _distances[minIdx])
+        {
+            minIdx = i;
+        }
+    }
+    return minIdx;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -0,0 +1,138 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <libutl/Mutex.h>
+#include <gop/Objective.h>
+#include <gop/StringInd.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Bounded archive of mutually non-dominated individuals.
+
+   An individual is admitted to the archive if no member dominates it (see Ind::dominates), and
+   its admission evicts the members it dominates.  When the archive is over capacity, the member
+   with the smallest crowding distance (the member in the most crowded part of the front) is
+   evicted, so the archive keeps a well-spread approximation of the Pareto front.  The extreme
+   members for each objective have infinite crowding distance, and are never evicted this way.
+
+   The archive is modified by the optimizer's thread, but its scores may be read (see getScores)
+   from another thread.
+
+   \see ParetoSA
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ParetoArchive : public utl::Object
+{
+    UTL_CLASS_DECL(ParetoArchive, utl::Object);
+    UTL_CLASS_NO_COPY;
+
+public:
+    /**
+       Constructor.
+       \param capacity maximum number of members
+       \param objectives objectives (one score per objective)
+    */
+    ParetoArchive(uint_t capacity, const objective_vector_t& objectives);
+
+    /** Remove all members. */
+    void clear();
+
+    /**
+       Offer an individual for admission.
+       \return true if ind was admitted (a copy of ind is added), false otherwise
+       \param ind individual (with one score per objective)
+    */
+    bool add(const StringInd<uint_t>& ind);
+
+    /** Is the given individual dominated by (or equivalent to) a member? */
+    bool dominated(const Ind& ind) const;
+
+    /// \name Accessors (const)
+    //@{
+    /** Get the capacity. */
+    uint_t
+    capacity() const
+    {
+        return _capacity;
+    }
+
+    /** Get the number of objectives. */
+    uint_t
+    numObjectives() const
+    {
+        return _objectives.size();
+    }
+
+    /** Get the number of members. */
+    uint_t
+    size() const
+    {
+        return _inds.size();
+    }
+
+    /** Empty? */
+    bool
+    empty() const
+    {
+        return _inds.empty();
+    }
+
+    /** Get the member at the given index. */
+    const StringInd<uint_t>*
+    get(uint_t idx) const
+    {
+        ASSERTD(idx < size());
+        return _inds[idx];
+    }
+
+    /**
+       Get the range of scores for the given objective.
+       \return false if the archive is empty, true otherwise
+       \param objectiveIdx objective index
+       \param minScore (out) minimum score
+       \param maxScore (out) maximum score
+    */
+    bool getRange(uint_t objectiveIdx, double& minScore, double& maxScore) const;
+
+    /**
+       Get a copy of all members' scores.
+       Scores are stored member-by-member: the score for objective j of member i is
+       `scores[(i * numObjectives()) + j]`.  This method may be called from any thread.
+       \param scores (out) members' scores
+    */
+    void getScores(std::vector<double>& scores) const;
+    //@}
+
+private:
+    using stringind_vector_t = std::vector<StringInd<uint_t>*>;
+
+private:
+    void init();
+    void deInit();
+
+    bool equivalent(const Ind& lhs, const Ind& rhs) const;
+    uint_t mostCrowded();
+
+private:
+    uint_t _capacity;
+    objective_vector_t _objectives;
+    stringind_vector_t _inds;
+    mutable utl::Mutex _mutex;
+
+    // scratch space for mostCrowded()
+    std::vector<double> _distances;
+    std::vector<uint_t> _order;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -0,0 +1,310 @@
+#include "libgop.h"
+#include "ParetoSA.h"
+#include "RevOperator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef DEBUG
+#define DEBUG_UNIT
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(gop::ParetoSA);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::initialize(const OptimizerConfiguration* config)
+{
+    Optimizer::initialize(config);
+
+    // initialize _ind
+    ASSERTD(_ind != nullptr);
+    _indBuilder->initializeInd(_ind, config->dataSet(), _rng);
+    _singleStep = false;
+
+    // one score per objective
+    uint_t numObjectives = _objectives.size();
+    _newScores.resize(numObjectives, nullptr);
+    _acceptedScores.resize(numObjectives, nullptr);
+
+    // the other objectives are evaluated in parallel (one thread per objective, so there's only
+    // more than one thread when there are three or more objectives)
+    uint_t numThreads = utl::max(config->numThreads(), (uint_t)1);
+    _objectiveEvaluator.initialize(utl::min(numThreads, numObjectives - 1));
+
+    // construct our initial individual and set initial & best scores
+    iterationRun();
+    if (_ind->newString())
+        _ind->acceptNewString();
+    evalObjectives();
+    setInitScore(utl::clone(_newScore));
+    setBestScore(utl::clone(_newScore));
+    for (uint_t i = 0; i != numObjectives; ++i)
+    {
+        _objectives[i]->setBestScore(utl::clone(_newScores[i]));
+    }
+    _bestString = utl::clone(_ind->stringPtr());
+    acceptNewScores();
+
+    // initialize the archive
+    _archive = new ParetoArchive(_archiveSize, _objectives);
+    if (_newFeasible)
+    {
+        _archive->add(*_ind);
+    }
+    _currentTemp = _initTemp;
+
+#ifdef DEBUG_UNIT
+    utl::cout << initString(!_fail) << utl::endlf;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ParetoSA::run()
+{
+    ASSERTD(!complete());
+    ASSERTD(_ind != nullptr);
+
+    bool complete = this->complete();
+    while (!complete)
+    {
+        _iteration++;
+
+        // choose an operator
+        auto op = chooseSuccessOp();
+        if (op == nullptr)
+        {
+            _iteration = _maxIterations;
+            complete = this->complete();
+            break;
+        }
+        auto rop = utl::cast<RevOperator>(op);
+        rop->addTotalIter();
+
+        // generate a new schedule, and evaluate all objectives
+        iterationRun(rop);
+        evalObjectives();
+
+        // offer the new individual to the archive
+        if (_newFeasible && _archive->add(*_ind))
+        {
+            rop->addSuccessIter();
+            _improvementIteration = _iteration;
+        }
+        updateBestScores();
+
+        // accept the new individual?
+        _accept = acceptNew();
+        if (_accept)
+        {
+            rop->accept();
+            acceptNewScores();
+        }
+        else
+        {
+            rop->undo();
+        }
+#ifdef DEBUG_UNIT
+        utl::cout << "archive:" << _archive->size() << ", " << iterationString() << utl::endl;
+#endif
+
+        _currentTemp = (double)pow(_tempDcrRate, (int)(_iteration / 100)) * _initTemp;
+        complete = this->complete();
+        if (!complete)
+        {
+            updateRunStatus(complete);
+        }
+    }
+    ASSERT(this->complete());
+
+    // re-generate the best schedule (for the first objective) and get audit text
+    _ind->setString(_bestString, false);
+    bool scheduleFeasible = iterationRun(nullptr, true);
+#ifdef DEBUG
+    if (scheduleFeasible)
+        ASSERTD(*_bestScore == *_newScore);
+#endif
+    utl::cout << finalString(scheduleFeasible) << utl::endlf;
+    updateRunStatus(true);
+    return scheduleFeasible;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::audit()
+{
+    ASSERTD(_bestString != nullptr);
+    _ind->setString(_bestString, false);
+    if (!iterationRun(nullptr, true))
+        ABORT();
+    ASSERTD(*_bestScore == *_newScore);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::init()
+{
+    _archiveSize = 50;
+    _archive = nullptr;
+    _initTemp = 0.1;
+    _tempDcrRate = 0.95;
+    _currentTemp = _initTemp;
+    _acceptedInd = new StringInd<uint_t>();
+    _newFeasible = false;
+    _acceptedFeasible = false;
+    _bestString = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::deInit()
+{
+    // _ind may refer to _bestString
+    if (_ind != nullptr)
+    {
+        _ind->setString(nullptr);
+    }
+    delete _archive;
+    deleteCont(_newScores);
+    deleteCont(_acceptedScores);
+    delete _acceptedInd;
+    delete _bestString;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::evalObjectives()
+{
+    // the first objective was evaluated by iterationRun()
+    copyScore(_newScores[0], _newScore);
+
+    // evaluate the other objectives (for the same schedule)
+    _objectiveEvaluator.run(_context, _objectives, _newScores, 1);
+
+    // set _ind's scores
+    uint_t numObjectives = _objectives.size();
+    _newFeasible = true;
+    for (uint_t i = 0; i != numObjectives; ++i)
+    {
+        auto score = _newScores[i];
+        _ind->setScore(i, score->getValue());
+        _newFeasible = _newFeasible && (score->getType() == score_succeeded);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ParetoSA::acceptNew()
+{
+    // new or accepted individual is infeasible -> compare the first objective only
+    if (!_newFeasible || !_acceptedFeasible)
+    {
+        return (_objectives[0]->compare(_newScores[0], _acceptedScores[0]) >= 0);
+    }
+
+    // new individual isn't dominated -> accept it
+    if (!_acceptedInd->dominates(_ind, _objectives))
+    {
+        return true;
+    }
+
+    // accept a dominated individual with probability exp(-d / temperature)
+    double acceptProb = exp(-dominationAmount() / _currentTemp);
+    return (_rng->uniform(0.0, 1.0) < acceptProb);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::acceptNewScores()
+{
+    uint_t numObjectives = _objectives.size();
+    for (uint_t i = 0; i != numObjectives; ++i)
+    {
+        copyScore(_acceptedScores[i], _newScores[i]);
+        _acceptedInd->setScore(i, _newScores[i]->getValue());
+    }
+    _acceptedFeasible = _newFeasible;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+ParetoSA::dominationAmount() const
+{
+    double amount = 0.0;
+    uint_t numObjectives = _objectives.size();
+    for (uint_t i = 0; i != numObjectives; ++i)
+    {
+        // new individual is worse for this objective?
+        double acceptedScore = _acceptedInd->getScore(i);
+        double diff = _objectives[i]->scoreDiff(_ind->getScore(i), acceptedScore);
+        if (diff >= 0.0)
+        {
+            continue;
+        }
+
+        // normalize by the range of the archive's scores (or the accepted score)
+        double minScore, maxScore;
+        double range;
+        if (_archive->getRange(i, minScore, maxScore) && (maxScore > minScore))
+        {
+            range = maxScore - minScore;
+        }
+        else
+        {
+            range = utl::max(fabs(acceptedScore), 1.0);
+        }
+        amount += -diff / range;
+    }
+    return amount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ParetoSA::updateBestScores()
+{
+    // each objective's own best score
+    uint_t numObjectives = _objectives.size();
+    for (uint_t i = 0; i != numObjectives; ++i)
+    {
+        auto objective = _objectives[i];
+        if (objective->compare(_newScores[i], objective->getBestScore()) > 0)
+        {
+            objective->copyBestScore(_newScores[i]);
+        }
+    }
+
+    // the run's best score (for the first objective)
+    int cmpResult = _objectives[0]->compare(_newScore, _bestScore);
+    _sameScore = (cmpResult == 0);
+    _newBest = (cmpResult > 0);
+    if (_newBest)
+    {
+        copyBestScore(_newScore);
+        _bestString->copy(_ind->string());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
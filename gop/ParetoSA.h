@@ -0,0 +1,94 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gop/Optimizer.h>
+#include <gop/ParallelObjectiveEvaluator.h>
+#include <gop/ParetoArchive.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Multi-objective (archive-based) simulated annealing.
+
+   Whereas other optimizers only evaluate the first objective, ParetoSA evaluates every objective
+   for each constructed individual, and keeps a ParetoArchive of the non-dominated individuals
+   it has found.
+
+   Each iteration mutates the current individual.  A new individual that isn't dominated by the
+   current one is always accepted.  Otherwise it's accepted with probability
+   `exp(-d / temperature)`, where `d` is the sum (over objectives) of how much worse the new
+   individual is, with each objective's difference normalized by the range of its scores in
+   the archive.
+
+   An iteration is counted as an improvement when the archive admits a new member.  The best
+   score (and best schedule) reported for the run are those of the first objective, and each
+   objective's own best score is also maintained (see Objective::getBestScore).
+
+   The first objective is evaluated as the individual is constructed, and the other objectives
+   are then evaluated in parallel (see ParallelObjectiveEvaluator).  Only the objectives after
+   the first are evaluated in parallel, so there's nothing to gain unless there are three or
+   more objectives.
+
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ParetoSA : public Optimizer
+{
+    UTL_CLASS_DECL(ParetoSA, Optimizer);
+
+public:
+    /** Initialize. */
+    virtual void initialize(const OptimizerConfiguration* config);
+
+    /** Run the optimizer. */
+    virtual bool run();
+
+    /** Audit the result. */
+    virtual void audit();
+
+    /** Get the archive of non-dominated individuals. */
+    const ParetoArchive*
+    archive() const
+    {
+        return _archive;
+    }
+
+private:
+    void init();
+    void deInit();
+
+    void evalObjectives();
+    bool acceptNew();
+    void acceptNewScores();
+    double dominationAmount() const;
+    void updateBestScores();
+
+private:
+    uint_t _archiveSize;
+    ParetoArchive* _archive;
+    double _initTemp;
+    double _tempDcrRate;
+    double _currentTemp;
+
+    // scores for the new and accepted individuals (one per objective)
+    score_vector_t _newScores;
+    score_vector_t _acceptedScores;
+    ParallelObjectiveEvaluator _objectiveEvaluator;
+    StringInd<uint_t>* _acceptedInd;
+    bool _newFeasible;
+    bool _acceptedFeasible;
+
+    // best string for the first objective
+    String<uint_t>* _bestString;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -95,11 +95,10 @@ RandomWalk::run()
         if (_newBest)
         {
             _improvementIteration = _iteration;
-            setBestScore(_newScore->clone());
-            String<uint_t>* str = _ind->stringPtr()->clone();
-            _bestStrScore->setScore(_bestScore->clone());
-            _bestStrScore->setString(str);
-            objective->setBestScore(_bestScore->clone());
+            copyBestScore(_newScore);
+            _bestStrScore->copyScore(_bestScore);
+            _bestStrScore->copyString(_ind->string());
+            objective->copyBestScore(_bestScore);
         }
 
 #ifdef DEBUG_UNIT
@@ -62,11 +62,62 @@ RunStatus::get(bool& complete, uint_t& currentIter, uint_t& bestIter, Score*& be
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void
+RunStatus::updateScoreCache(uint_t numLookups, uint_t numHits)
+{
+    _mutex.lock();
+    _numCacheLookups = numLookups;
+    _numCacheHits = numHits;
+    _mutex.unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+RunStatus::scoreCacheHitRate() const
+{
+    _mutex.lock();
+    double hitRate = (_numCacheLookups == 0) ? 0.0 : (double)_numCacheHits / _numCacheLookups;
+    _mutex.unlock();
+    return hitRate;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+RunStatus::updateCapExps(uint_t numLive, uint_t numTouched, uint_t numCapExps)
+{
+    _mutex.lock();
+    _numLiveCapExps = numLive;
+    _numTouchedCapExps = numTouched;
+    _numCapExps = numCapExps;
+    _mutex.unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+RunStatus::getCapExps(uint_t& numLive, uint_t& numTouched, uint_t& numCapExps) const
+{
+    _mutex.lock();
+    numLive = _numLiveCapExps;
+    numTouched = _numTouchedCapExps;
+    numCapExps = _numCapExps;
+    _mutex.unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void
 RunStatus::init()
 {
     _complete = false;
     _currentIter = _bestIter = uint_t_max;
+    _numCacheLookups = 0;
+    _numCacheHits = 0;
+    _numLiveCapExps = 0;
+    _numTouchedCapExps = 0;
+    _numCapExps = 0;
     _bestScore = new Score();
 }
 
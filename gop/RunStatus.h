@@ -19,6 +19,8 @@ GOP_NS_BEGIN;
      - current count of iterations
      - iteration that produced the best Score so far
      - the best Score found so far
+     - score cache statistics (see ScoreCache)
+     - capacity-expression statistics of the last constructed individual (see cls::CapExpMgr)
 
    \ingroup gop
 */
@@ -49,6 +51,32 @@ public:
     */
     void get(bool& complete, uint_t& currentIter, uint_t& bestIter, Score*& bestScore) const;
 
+    /**
+       Update the score cache statistics.
+       \param numLookups number of score cache lookups
+       \param numHits number of lookups that found a score
+    */
+    void updateScoreCache(uint_t numLookups, uint_t numHits);
+
+    /** Get the score cache hit rate (0 if there were no lookups). */
+    double scoreCacheHitRate() const;
+
+    /**
+       Update the capacity-expression statistics.
+       \param numLive number of live capacity expressions
+       \param numTouched number of capacity expressions touched by the last construction
+       \param numCapExps number of capacity expressions
+    */
+    void updateCapExps(uint_t numLive, uint_t numTouched, uint_t numCapExps);
+
+    /**
+       Get the capacity-expression statistics.
+       \param numLive (out) number of live capacity expressions
+       \param numTouched (out) number of capacity expressions touched by the last construction
+       \param numCapExps (out) number of capacity expressions
+    */
+    void getCapExps(uint_t& numLive, uint_t& numTouched, uint_t& numCapExps) const;
+
 private:
     void init();
     void deInit();
@@ -59,6 +87,11 @@ private:
     uint_t _bestIter;
     Score* _bestScore;
     uint_t _scoreType;
+    uint_t _numCacheLookups;
+    uint_t _numCacheHits;
+    uint_t _numLiveCapExps;
+    uint_t _numTouchedCapExps;
+    uint_t _numCapExps;
     mutable utl::Mutex _mutex;
 };
 
@@ -37,6 +37,13 @@ SAoptimizer::initialize(const OptimizerConfiguration* config)
 
     // disable single-step
     _singleStep = false;
+    _coolingSchedule = config->coolingSchedule();
+
+    // adaptive schedules follow the run's progress -> they need an iteration or time budget
+    if ((_maxIterations == uint_t_max) && !timeBudgeted())
+    {
+        _coolingSchedule = cooling_geometric;
+    }
 
     iterationRun();
     setInitScore(_newScore->clone());
@@ -151,7 +158,8 @@ SAoptimizer::SAiterationRun()
     utl::cout << "  " << op->toString() << utl::endlf;
 #endif
 
-    // generate and evaluate a new schedule
+    // generate and evaluate a new schedule (abandoning it once it can't be accepted)
+    setAcceptanceBound();
     iterationRun(rop);
 
     // decide whether accept the new schedule
@@ -176,7 +184,7 @@ SAoptimizer::storeScoreDiff(double diff)
     _scoreDiff = diff;
 
     // don't record statistics during initialization
-    if (_fixedInitTemp)
+    if (!recordScoreDiffs())
         return;
 
     // update _totalScoreDiff, _totalScoreDiffIter
@@ -233,15 +241,17 @@ SAoptimizer::acceptanceEval(RevOperator* op)
     else
     {
         auto acceptProb = exp(_scoreDiff / _currentTemp);
-        _accept = (_rng->uniform(0.0, 1.0) < acceptProb);
+        auto rand = (_acceptRand >= 0.0) ? _acceptRand : _rng->uniform(0.0, 1.0);
+        _accept = (rand < acceptProb);
     }
 #ifdef DEBUG_UNIT
     utl::cout << temperatureString() << utl::endl;
 #endif
     if (_accept)
     {
+        ++_numAccepted;
         op->accept();
-        setAcceptedScore(utl::clone(_newScore));
+        copyScore(_acceptedScore, _newScore);
         cmpResult = objective->compare(_newScore, _bestScore);
         _newBest = (cmpResult > 0);
         _sameScore = (cmpResult == 0);
@@ -249,10 +259,10 @@ SAoptimizer::acceptanceEval(RevOperator* op)
         {
             op->addSuccessIter();
             _improvementIteration = _iteration;
-            setBestScore(utl::clone(_newScore));
-            _bestStrScore->setScore(utl::clone(_bestScore));
-            _bestStrScore->setString(utl::clone(_ind->stringPtr()));
-            objective->setBestScore(utl::clone(_bestScore));
+            copyBestScore(_newScore);
+            _bestStrScore->copyScore(_bestScore);
+            _bestStrScore->copyString(_ind->string());
+            objective->copyBestScore(_bestScore);
         }
     }
     else
@@ -265,8 +275,109 @@ SAoptimizer::acceptanceEval(RevOperator* op)
     if (_tempIteration == _populationSize)
     {
         _tempIteration = 0;
-        _currentTemp = _currentTemp * _tempDcrRate;
+        updateTemp();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SAoptimizer::updateTemp()
+{
+    double acceptanceRate = (double)_numAccepted / utl::max(_populationSize, (uint_t)1);
+    _numAccepted = 0;
+    ++_tempSteps;
+
+    // geometric cooling
+    if (_coolingSchedule == cooling_geometric)
+    {
+        if (timeBudgeted())
+        {
+            _currentTemp = _initTemp * pow(_tempDcrRate, timeBudgetTempSteps(_populationSize));
+        }
+        else
+        {
+            _currentTemp = _currentTemp * _tempDcrRate;
+        }
+        return;
+    }
+
+    // no worsening moves seen yet -> keep the current temperature
+    if (_totalScoreDiffIter == 0)
+    {
+        return;
+    }
+    double avgScoreDiff = _totalScoreDiff / _totalScoreDiffIter;
+    double targetRate = utl::min(lamTargetRate(), 0.99);
+    if ((_coolingSchedule == cooling_lam) || (_tempSteps == 1))
+    {
+        // accept a typical worsening move at the target rate
+        _currentTemp = -avgScoreDiff / log(targetRate);
+    }
+    else
+    {
+        // accepting too often -> cool, not often enough -> heat
+        _currentTemp *= exp(targetRate - acceptanceRate);
+    }
+
+    // forget old statistics gradually (worsening moves get smaller as the search converges)
+    if (_totalScoreDiffIter > (4 * _populationSize))
+    {
+        _totalScoreDiff /= 2;
+        _totalScoreDiffIter /= 2;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+SAoptimizer::lamTargetRate() const
+{
+    double f = elapsedFraction();
+    if (f < 0.15)
+    {
+        return 0.44 + 0.56 * pow(560.0, -f / 0.15);
+    }
+    if (f < 0.65)
+    {
+        return 0.44;
+    }
+    return 0.44 * pow(440.0, -(f - 0.65) / 0.35);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+SAoptimizer::setAcceptanceBound()
+{
+    // no bound while gathering score-diff statistics (abandoned schedules have no diff)
+    _acceptRand = -1.0;
+    if (!_scoreBounding || recordScoreDiffs() || (_acceptedScore->getType() != score_succeeded))
+    {
+        return;
+    }
+
+    // draw the acceptance test's random number in advance:
+    // rand < exp((accepted - new) / temp)  <=>  new < accepted - temp * log(rand)
+    _acceptRand = _rng->uniform(0.0, 1.0);
+    if (_acceptRand > 0.0)
+    {
+        setScoreBound(_acceptedScore->getValue() - (_currentTemp * log(_acceptRand)));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+SAoptimizer::timeBudgetTempSteps(uint_t tempIterations) const
+{
+    ASSERTD(timeBudgeted());
+    double numSteps = 100.0;
+    if (_maxIterations != uint_t_max)
+    {
+        numSteps = (double)_maxIterations / utl::max(tempIterations, (uint_t)1);
     }
+    return elapsedFraction() * numSteps;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,6 +388,7 @@ SAoptimizer::init()
     _bestStrScore = nullptr;
     _acceptedScore = nullptr;
     _scoreDiff = 0;
+    _acceptRand = -1.0;
     _tempDcrRate = 0.9;
     _initTemp = 1000.0;
     _currentTemp = 1000.0;
@@ -284,6 +396,9 @@ SAoptimizer::init()
     _totalScoreDiff = 0;
     _totalScoreDiffIter = 0;
 
+    _coolingSchedule = cooling_geometric;
+    _tempSteps = 0;
+    _numAccepted = 0;
     _fixedInitTemp = true;
     _populationSize = 100;
     _tempIteration = 0;
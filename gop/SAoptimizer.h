@@ -26,6 +26,20 @@ GOP_NS_BEGIN;
    by applying the Metropolis criterion. Kirkpatrick and his co-workers created such a
    combinatorial optimization algorithm, and called it 'simulated annealing'.
 
+   The temperature is updated after each population of iterations (100 by default), according
+   to the configured cooling schedule (see OptimizerConfiguration::coolingSchedule):
+
+   - cooling_geometric: the temperature is reduced by a fixed rate (_tempDcrRate)
+   - cooling_lam: the temperature is set so that a typical worsening move (the average of recent
+     worsening score diffs) is accepted at Lam-Delosme's target acceptance rate for the elapsed
+     part of the run (see lamTargetRate)
+   - cooling_feedback: the temperature is raised or lowered according to the difference between
+     the observed acceptance rate and Lam-Delosme's target rate
+
+   The adaptive schedules cool in a single pass, without probing for an initial temperature.
+   Their target rate depends on the elapsed part of the run, so they're only used when the run
+   has an iteration or time budget (geometric cooling is used otherwise).
+
    \ingroup gop
 */
 
@@ -69,10 +83,44 @@ protected:
     /** Decide whether to accept the new solution. */
     virtual void acceptanceEval(RevOperator* op);
 
+    /** Update the temperature (after each _populationSize iterations). */
+    void updateTemp();
+
+    /**
+       Get Lam-Delosme's target acceptance rate for the elapsed part of the run: it falls
+       quickly from 100% to 44%, stays there until 65% of the run has elapsed, then falls
+       to 0.1% at the end of the run.
+    */
+    double lamTargetRate() const;
+
+    /** Record score-diff statistics?  (They're needed to set the temperature.) */
+    bool
+    recordScoreDiffs() const
+    {
+        return !_fixedInitTemp || (_coolingSchedule != cooling_geometric);
+    }
+
+    /**
+       Set the score bound for the next construction (see Optimizer::setScoreBound).
+       The acceptance test's random number is drawn before construction, which determines the
+       worst score that will be accepted.
+    */
+    void setAcceptanceBound();
+
+    /**
+       Get the number of temperature reductions for the elapsed part of a time-budgeted run.
+       The reductions are spread over the budget as they'd be spread over the iteration budget
+       (or 100 reductions if the iterations are unlimited), so the run is fully cooled when its
+       time runs out, however long each iteration takes.
+       \param tempIterations number of iterations at each temperature
+    */
+    double timeBudgetTempSteps(uint_t tempIterations) const;
+
 protected:
     StringScore* _bestStrScore;
     Score* _acceptedScore;
     double _scoreDiff;
+    double _acceptRand; // acceptance test's random number (if drawn in advance)
     double _tempDcrRate;
     double _initTemp;    // initial temperature
     double _currentTemp; // current temperature
@@ -82,6 +130,9 @@ protected:
     uint_t _totalScoreDiffIter; // total #iters for _totalScoreDiff
 
     // Optimizer customization parameters
+    cooling_schedule_t _coolingSchedule;
+    uint_t _tempSteps;   // #/temperature updates
+    uint_t _numAccepted; // #/accepted moves at the current temperature
     bool _fixedInitTemp;
     uint_t _populationSize; // #/tries at each temperature.
     uint_t _tempIteration;  // count #iters at each temperature.
@@ -103,6 +103,12 @@ private:
 */
 using uint_score_map_t = std::map<uint_t, Score*>;
 
+/**
+   A \c std::vector of Score pointers.
+   \ingroup gop
+*/
+using score_vector_t = std::vector<Score*>;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 GOP_NS_END;
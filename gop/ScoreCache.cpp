@@ -0,0 +1,86 @@
+#include "libgop.h"
+#include "ScoreCache.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(gop::ScoreCache);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ScoreCache::ScoreCache(uint_t capacity)
+{
+    init();
+    uint_t size = 1;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    _entries.resize(size);
+    _mask = size - 1;
+    clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ScoreCache::clear()
+{
+    for (auto& entry : _entries)
+    {
+        entry.hash = 0;
+        entry.type = score_undefined;
+    }
+    _numLookups = 0;
+    _numHits = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+ScoreCache::find(uint64_t hash, Score& score)
+{
+    ++_numLookups;
+    auto& entry = _entries[hash & _mask];
+    if ((entry.type == score_undefined) || (entry.hash != hash))
+    {
+        return false;
+    }
+    ++_numHits;
+    score.setValue(entry.value);
+    score.setType(entry.type);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ScoreCache::add(uint64_t hash, Score* score)
+{
+    auto& entry = _entries[hash & _mask];
+    entry.hash = hash;
+    entry.value = score->getValue();
+    entry.type = score->getType();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ScoreCache::init()
+{
+    _mask = 0;
+    _numLookups = 0;
+    _numHits = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
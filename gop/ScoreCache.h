@@ -0,0 +1,108 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gop/Score.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Bounded memo table of scores, keyed by String hash (see String::hash).
+
+   Operators often return the string to a state that has already been scored (e.g. a move that
+   is undone, followed by the opposite move).  Remembering the score of each recently
+   constructed string lets the optimizer skip re-constructing it.
+
+   The table is direct-mapped: each hash maps to one slot, and a new entry replaces whatever
+   occupies its slot.  So it has a fixed size, and lookup and insertion are O(1) without
+   locking (the table is owned by one optimizer thread).
+
+   \see Optimizer::iterationRun
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ScoreCache : public utl::Object
+{
+    UTL_CLASS_DECL(ScoreCache, utl::Object);
+    UTL_CLASS_NO_COPY;
+
+public:
+    /**
+       Constructor.
+       \param capacity number of entries (rounded up to a power of 2)
+    */
+    ScoreCache(uint_t capacity);
+
+    /** Remove all entries. */
+    void clear();
+
+    /**
+       Find the score for the given hash.
+       \return true if found (score is set), false otherwise
+       \param hash string hash
+       \param score (out) score
+    */
+    bool find(uint64_t hash, Score& score);
+
+    /**
+       Add the score for the given hash.
+       \param hash string hash
+       \param score score
+    */
+    void add(uint64_t hash, Score* score);
+
+    /// \name Accessors (const)
+    //@{
+    /** Get the number of entries. */
+    uint_t
+    capacity() const
+    {
+        return _entries.size();
+    }
+
+    /** Get the number of lookups. */
+    uint_t
+    numLookups() const
+    {
+        return _numLookups;
+    }
+
+    /** Get the number of lookups that found a score. */
+    uint_t
+    numHits() const
+    {
+        return _numHits;
+    }
+    //@}
+
+private:
+    struct Entry
+    {
+        uint64_t hash;
+        double value;
+        score_type_t type;
+    };
+
+private:
+    void init();
+    void
+    deInit()
+    {
+    }
+
+private:
+    std::vector<Entry> _entries;
+    uint64_t _mask;
+    uint_t _numLookups;
+    uint_t _numHits;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
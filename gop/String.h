@@ -13,6 +13,11 @@ GOP_NS_BEGIN;
    individual.  The format of the instructions must be known by the operators that change them,
    and by the individual-builder that follows them in order to construct individuals.
 
+   A String maintains a 64-bit hash of its contents (see hash()).  The hash is updated in O(1)
+   by set(), so an Operator that changes a few positions with set() can keep it current
+   without a full scan.  Any other non-const access to the values (operator[], get())
+   invalidates the hash, and the next call to hash() recomputes it.
+
    \see gop::IndBuilder
    \see gop::Operator
    \ingroup gop
@@ -53,6 +58,14 @@ public:
         return _vect;
     }
 
+    /** Get the value at the given index. */
+    const T&
+    get(uint_t idx) const
+    {
+        ASSERTD(idx < _size);
+        return _vect[idx];
+    }
+
     /** Get the value at the given index. */
     const T& operator[](int idx) const
     {
@@ -66,28 +79,40 @@ public:
         ASSERTD(idx < size());
         return _vect[idx];
     }
+
+    /** Get the hash of the contents. */
+    uint64_t
+    hash() const
+    {
+        if (!_hashValid)
+            rehash();
+        return _hash;
+    }
     //@}
 
     /// \name Accessors (non-const)
     //@{
-    /** Get the array. */
+    /** Get the array (invalidates the hash). */
     T*
     get()
     {
+        _hashValid = false;
         return _vect;
     }
 
-    /** Get the value at the given index. */
+    /** Get the value at the given index (invalidates the hash). */
     T& operator[](int idx)
     {
         ASSERTD((idx >= 0) && ((uint_t)idx < _size));
+        _hashValid = false;
         return _vect[idx];
     }
 
-    /** Get the value at the given index. */
+    /** Get the value at the given index (invalidates the hash). */
     T& operator[](uint_t idx)
     {
         ASSERTD(idx < size());
+        _hashValid = false;
         return _vect[idx];
     }
     //@}
@@ -101,13 +126,24 @@ public:
         setSize(0);
     }
 
-    /** Set the size. */
+    /** Set the size (the array is re-used if the size doesn't change). */
     void setSize(uint_t size);
 
+    /** Set the value at the given index (updating the hash). */
+    void
+    set(uint_t idx, const T& val)
+    {
+        ASSERTD(idx < _size);
+        if (_hashValid)
+            _hash ^= hashValue(idx, _vect[idx]) ^ hashValue(idx, val);
+        _vect[idx] = val;
+    }
+
     /** Randomly shuffle. */
     void
     shuffle(lut::rng_t& rng)
     {
+        _hashValid = false;
         rng.shuffle(_vect, _vect + _size);
     }
     //@}
@@ -125,9 +161,19 @@ private:
     void init(uint_t size = 0);
     void deInit();
 
+    static uint64_t
+    hashValue(uint_t idx, const T& val)
+    {
+        return lut::hashCombine(lut::hashCombine(0, idx), (uint64_t)val);
+    }
+
+    void rehash() const;
+
 private:
     uint_t _size;
     T* _vect;
+    mutable uint64_t _hash;
+    mutable bool _hashValid;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +189,8 @@ String<T>::copy(const utl::Object& rhs)
     {
         _vect[i] = s._vect[i];
     }
+    _hash = s._hash;
+    _hashValid = s._hashValid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +215,11 @@ template <class T>
 void
 String<T>::setSize(uint_t size)
 {
+    _hashValid = false;
+    if ((size == _size) && (_vect != nullptr))
+    {
+        return;
+    }
     _size = size;
     delete[] _vect;
     if (_size == 0)
@@ -181,6 +234,21 @@ String<T>::setSize(uint_t size)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+template <class T>
+void
+String<T>::rehash() const
+{
+    // XOR of the (index,value) hashes, so set() can replace one value in O(1)
+    _hash = 0;
+    for (uint_t i = 0; i < _size; i++)
+    {
+        _hash ^= hashValue(i, _vect[i]);
+    }
+    _hashValid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <class T>
 void
 String<T>::crossover(String<T>* off1, String<T>* off2, const String<T>& rhs, uint_t pos) const
@@ -230,6 +298,8 @@ String<T>::init(uint_t size)
 {
     _size = size;
     _vect = new T[size];
+    _hash = 0;
+    _hashValid = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,7 +144,7 @@ public:
     void
     set(uint_t pos, uint_t val)
     {
-        (*_string)[pos] = val;
+        _string->set(pos, val);
     }
 
     /** Set string pointer. */
@@ -88,6 +88,34 @@ public:
         delete _score;
         _score = score;
     }
+
+    /** Copy the given String (re-using the existing String's array). */
+    void
+    copyString(const String<uint_t>& string)
+    {
+        if (_string == nullptr)
+        {
+            _string = string.clone();
+        }
+        else
+        {
+            _string->copy(string);
+        }
+    }
+
+    /** Copy the given Score (re-using the existing Score object). */
+    void
+    copyScore(const Score* score)
+    {
+        if (_score == nullptr)
+        {
+            _score = score->clone();
+        }
+        else
+        {
+            _score->copy(*score);
+        }
+    }
     //@}
 
 private:
@@ -0,0 +1,329 @@
+#include "libgop.h"
+#include "TabuSearch.h"
+#include "RevOperator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef DEBUG
+#define DEBUG_UNIT
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+LUT_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_CLASS_IMPL(gop::TabuSearch);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TabuSearch::initialize(const OptimizerConfiguration* config)
+{
+    Optimizer::initialize(config);
+
+    // initialize _ind
+    ASSERTD(_ind != nullptr);
+    _indBuilder->initializeInd(_ind, config->dataSet(), _rng);
+    _singleStep = false;
+
+    // construct our initial individual and set initial & best scores
+    iterationRun();
+    setInitScore(utl::clone(_newScore));
+    setBestScore(utl::clone(_newScore));
+    if (_ind->newString())
+        _ind->acceptNewString();
+    auto objective = _objectives[0];
+    objective->setBestScore(utl::clone(_bestScore));
+    _bestString = utl::clone(_ind->stringPtr());
+
+#ifdef DEBUG_UNIT
+    utl::cout << initString(!_fail) << utl::endlf;
+#endif
+
+    // neighbors are constructed in parallel
+    _parallelIndBuilder.initialize(config, _context, _indBuilder, objective, _ind, _rng);
+    _neighborhoodSize = utl::max(_neighborhoodSize, numThreads());
+    for (uint_t i = 0; i != _neighborhoodSize; ++i)
+    {
+        _neighbors.push_back(lut::clone(_ind));
+        _neighborScores.push_back(utl::clone(_bestScore));
+        _neighborOps.push_back(nullptr);
+    }
+    _neighborMoves.resize(_neighborhoodSize, 0);
+    _neighborReverseMoves.resize(_neighborhoodSize, 0);
+    _neighborChanged.resize(_neighborhoodSize, false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+TabuSearch::run()
+{
+    ASSERTD(!complete());
+    ASSERTD(_ind != nullptr);
+
+    auto objective = _objectives[0];
+    bool complete = this->complete();
+
+    while (!complete)
+    {
+        // no iterations left (e.g. the run was stopped before its first iteration)?
+        if (_iteration >= _maxIterations)
+        {
+            break;
+        }
+
+        // sample the neighborhood, and construct the neighbors in parallel
+        uint_t numNeighbors = utl::min(_neighborhoodSize, _maxIterations - _iteration);
+        numNeighbors = sampleNeighborhood(numNeighbors);
+        if (numNeighbors == 0)
+        {
+            _iteration = _maxIterations;
+            complete = this->complete();
+            break;
+        }
+        _parallelIndBuilder.run(_neighbors, _neighborScores, numNeighbors);
+        _iteration += numNeighbors;
+        ++_step;
+
+        // move to the best admissible neighbor
+        uint_t neighborIdx = selectNeighbor(numNeighbors);
+        if (neighborIdx != uint_t_max)
+        {
+            auto neighbor = _neighbors[neighborIdx];
+            auto& score = _neighborScores[neighborIdx];
+            _ind->string().copy(neighbor->string());
+            copyNewScore(score);
+            _fail = ((score->getType() != score_succeeded) &&
+                     (score->getType() != score_ct_violated));
+            makeTabu(_neighborReverseMoves[neighborIdx]);
+            _accept = true;
+
+            // new best?
+            int cmpResult = objective->compare(score, _bestScore);
+            _sameScore = (cmpResult == 0);
+            _newBest = (cmpResult > 0);
+            if (_newBest)
+            {
+                auto rop = dynamic_cast<RevOperator*>(_neighborOps[neighborIdx]);
+                if (rop != nullptr)
+                {
+                    rop->addSuccessIter();
+                }
+                _improvementIteration = _iteration;
+                copyBestScore(score);
+                _bestString->copy(neighbor->string());
+                objective->copyBestScore(_bestScore);
+            }
+        }
+        else
+        {
+            _accept = false;
+            _newBest = false;
+            _sameScore = false;
+        }
+#ifdef DEBUG_UNIT
+        utl::cout << "tabu:" << _tabuList.size() << ", " << iterationString() << utl::endl;
+#endif
+
+        complete = this->complete();
+        if (!complete)
+        {
+            updateRunStatus(complete);
+        }
+    }
+    ASSERT(this->complete() || (_iteration >= _maxIterations));
+
+    // re-generate the best schedule and get audit text
+    _ind->setString(_bestString, false);
+    bool scheduleFeasible = iterationRun(nullptr, true);
+#ifdef DEBUG
+    if (scheduleFeasible)
+        ASSERTD(*_bestScore == *_newScore);
+#endif
+    utl::cout << finalString(scheduleFeasible) << utl::endlf;
+    updateRunStatus(true);
+    return scheduleFeasible;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TabuSearch::audit()
+{
+    ASSERTD(_bestString != nullptr);
+    _ind->setString(_bestString, false);
+    if (!iterationRun(nullptr, true))
+        ABORT();
+    ASSERTD(*_bestScore == *_newScore);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TabuSearch::init()
+{
+    _neighborhoodSize = 10;
+    _tenure = 10;
+    _step = 0;
+    _bestString = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TabuSearch::deInit()
+{
+    // _ind may refer to _bestString
+    if (_ind != nullptr)
+    {
+        _ind->setString(nullptr);
+    }
+    delete _bestString;
+    deleteCont(_neighbors);
+    deleteCont(_neighborScores);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+TabuSearch::sampleNeighborhood(uint_t numNeighbors)
+{
+    auto& str = _ind->string();
+    for (uint_t i = 0; i != numNeighbors; ++i)
+    {
+        auto op = chooseRandomOp();
+        if (op == nullptr)
+        {
+            return 0;
+        }
+        auto rop = dynamic_cast<RevOperator*>(op);
+        if (rop != nullptr)
+        {
+            rop->addTotalIter();
+        }
+
+        // execute the operator on a copy of the current individual
+        auto neighbor = _neighbors[i];
+        neighbor->string().copy(str);
+        try
+        {
+            _context->clear();
+            op->execute(neighbor, _context, _singleStep);
+        }
+        catch (...)
+        {
+        }
+        if (rop != nullptr)
+        {
+            rop->accept();
+        }
+        _neighborOps[i] = op;
+        uint_t opIdx = std::find(_ops.begin(), _ops.end(), op) - _ops.begin();
+        hashMove(i, opIdx);
+    }
+    return numNeighbors;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t
+TabuSearch::selectNeighbor(uint_t numNeighbors) const
+{
+    auto objective = _objectives[0];
+    uint_t bestIdx = uint_t_max;
+    for (uint_t i = 0; i != numNeighbors; ++i)
+    {
+        // operator didn't change the string -> not a move
+        if (!_neighborChanged[i])
+        {
+            continue;
+        }
+
+        // tabu move is admissible only if it improves on the best score (aspiration)
+        auto score = _neighborScores[i];
+        if (tabu(_neighborMoves[i]) && (objective->compare(score, _bestScore) <= 0))
+        {
+            continue;
+        }
+        if ((bestIdx == uint_t_max) || (objective->compare(score, _neighborScores[bestIdx]) > 0))
+        {
+            bestIdx = i;
+        }
+    }
+    return bestIdx;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TabuSearch::hashMove(uint_t neighborIdx, uint_t opIdx)
+{
+    // the move is identified by the operator and the (position,value) pairs it changed,
+    // and the reverse move restores the old values
+    auto& oldStr = _ind->string();
+    auto& newStr = _neighbors[neighborIdx]->string();
+    uint64_t move = hashCombine(0, opIdx);
+    uint64_t reverseMove = move;
+    bool changed = false;
+    uint_t stringSize = oldStr.size();
+    for (uint_t pos = 0; pos != stringSize; ++pos)
+    {
+        uint_t oldVal = oldStr[pos];
+        uint_t newVal = newStr[pos];
+        if (newVal == oldVal)
+        {
+            continue;
+        }
+        changed = true;
+        move = hashCombine(hashCombine(move, pos), newVal);
+        reverseMove = hashCombine(hashCombine(reverseMove, pos), oldVal);
+    }
+    _neighborMoves[neighborIdx] = move;
+    _neighborReverseMoves[neighborIdx] = reverseMove;
+    _neighborChanged[neighborIdx] = changed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool
+TabuSearch::tabu(uint64_t move) const
+{
+    auto it = _tabuList.find(move);
+    return (it != _tabuList.end()) && (it->second > _step);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+TabuSearch::makeTabu(uint64_t move)
+{
+    _tabuList[move] = _step + _tenure;
+
+    // remove expired moves
+    if (_tabuList.size() > (4 * _tenure))
+    {
+        for (auto it = _tabuList.begin(); it != _tabuList.end();)
+        {
+            if (it->second <= _step)
+            {
+                it = _tabuList.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
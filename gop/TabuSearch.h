@@ -0,0 +1,109 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gop/Optimizer.h>
+#include <gop/ParallelIndBuilder.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Tabu search.
+
+   Each step samples a neighborhood of the current individual: each neighbor is made by
+   executing a randomly chosen operator on a copy of the current individual.  The neighborhood is
+   constructed and evaluated in parallel (see ParallelIndBuilder), and the search moves to the
+   best neighbor whose move isn't tabu, even if it's worse than the current individual.
+
+   A move is identified by a hash of the operator and the values it changed (each changed string
+   position and its new value).  After a move is made, the reverse move (restoring the old
+   values) is tabu for the next `tenure` steps, which keeps the search from cycling back to
+   recently visited individuals.  A tabu move is still allowed if it produces a new best score
+   (aspiration).
+
+   Each constructed neighbor counts as one iteration.
+
+   \ingroup gop
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class TabuSearch : public Optimizer
+{
+    UTL_CLASS_DECL(TabuSearch, Optimizer);
+
+public:
+    /** Initialize. */
+    virtual void initialize(const OptimizerConfiguration* config);
+
+    /** Run the tabu search. */
+    virtual bool run();
+
+    /** Audit the result. */
+    virtual void audit();
+
+    /** Get the neighborhood size. */
+    uint_t
+    neighborhoodSize() const
+    {
+        return _neighborhoodSize;
+    }
+
+    /** Get the number of threads. */
+    uint_t
+    numThreads() const
+    {
+        return _parallelIndBuilder.numThreads();
+    }
+
+    /** Get the tabu tenure (in steps). */
+    uint_t
+    tenure() const
+    {
+        return _tenure;
+    }
+
+protected:
+    virtual double
+    workersCPUtime() const
+    {
+        return _parallelIndBuilder.cpuTime();
+    }
+
+private:
+    using tabu_map_t = std::unordered_map<uint64_t, uint_t>;
+
+private:
+    void init();
+    void deInit();
+
+    uint_t sampleNeighborhood(uint_t numNeighbors);
+    uint_t selectNeighbor(uint_t numNeighbors) const;
+    void hashMove(uint_t neighborIdx, uint_t opIdx);
+    bool tabu(uint64_t move) const;
+    void makeTabu(uint64_t move);
+
+private:
+    uint_t _neighborhoodSize;
+    uint_t _tenure;
+    uint_t _step;
+    tabu_map_t _tabuList;
+    String<uint_t>* _bestString;
+
+    // neighborhood
+    stringind_vector_t _neighbors;
+    score_vector_t _neighborScores;
+    op_vector_t _neighborOps;
+    std::vector<uint64_t> _neighborMoves;
+    std::vector<uint64_t> _neighborReverseMoves;
+    std::vector<bool> _neighborChanged;
+    ParallelIndBuilder _parallelIndBuilder;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GOP_NS_END;
@@ -0,0 +1,171 @@
+#include "liblut.h"
+#include "ThreadPool.h"
+#include <pthread.h>
+#include <time.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+UTL_NS_USE;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LUT_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ThreadPool::ThreadPool(uint_t numThreads)
+{
+    _numThreads = utl::max(numThreads, (uint_t)1);
+    _func = nullptr;
+    _numTasks = 0;
+    _generation = 0;
+    _numBusy = 0;
+    _stop = false;
+
+    // start worker threads (the calling thread is thread 0)
+    for (uint_t threadIdx = 1; threadIdx < _numThreads; ++threadIdx)
+    {
+        _threads.emplace_back(&ThreadPool::work, this, threadIdx);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _startCV.notify_all();
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double
+ThreadPool::cpuTime() const
+{
+    // each worker thread has its own CPU-time clock
+    double cpuTime = 0.0;
+    for (auto& thread : _threads)
+    {
+        clockid_t clock;
+        struct timespec ts;
+        auto handle = const_cast<std::thread&>(thread).native_handle();
+        if ((pthread_getcpuclockid(handle, &clock) == 0) && (clock_gettime(clock, &ts) == 0))
+        {
+            cpuTime += (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+        }
+    }
+    return cpuTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ThreadPool::run(uint_t numTasks, const task_func_t& func)
+{
+    if (numTasks == 0)
+    {
+        return;
+    }
+
+    // single thread (or a single task) -> just do the work
+    if ((_numThreads == 1) || (numTasks == 1))
+    {
+        for (uint_t taskIdx = 0; taskIdx != numTasks; ++taskIdx)
+        {
+            func(taskIdx, 0);
+        }
+        return;
+    }
+
+    // wake up the workers
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _func = &func;
+        _numTasks = numTasks;
+        _numBusy = _numThreads - 1;
+        _exception = nullptr;
+        ++_generation;
+    }
+    _startCV.notify_all();
+
+    // do our own share of the work
+    runBlock(0);
+
+    // wait for the workers to finish
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCV.wait(lock, [this] { return (_numBusy == 0); });
+    _func = nullptr;
+    if (_exception != nullptr)
+    {
+        auto ex = _exception;
+        _exception = nullptr;
+        std::rethrow_exception(ex);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ThreadPool::work(uint_t threadIdx)
+{
+    uint_t generation = 0;
+    while (true)
+    {
+        // wait for work (or a request to stop)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _startCV.wait(lock, [&] { return _stop || (_generation != generation); });
+            if (_stop)
+            {
+                return;
+            }
+            generation = _generation;
+        }
+
+        runBlock(threadIdx);
+
+        // let run() know we're done
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_numBusy == 0)
+        {
+            _doneCV.notify_one();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void
+ThreadPool::runBlock(uint_t threadIdx)
+{
+    // this thread's block of tasks: [begin, end)
+    uint64_t numTasks = _numTasks;
+    uint_t begin = (uint_t)((numTasks * threadIdx) / _numThreads);
+    uint_t end = (uint_t)((numTasks * (threadIdx + 1)) / _numThreads);
+    try
+    {
+        for (uint_t taskIdx = begin; taskIdx != end; ++taskIdx)
+        {
+            (*_func)(taskIdx, threadIdx);
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_exception == nullptr)
+        {
+            _exception = std::current_exception();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LUT_NS_END;
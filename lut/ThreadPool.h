@@ -0,0 +1,92 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#undef new
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <libutl/gblnew_macros.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LUT_NS_BEGIN;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+   Fixed-size pool of worker threads for fork/join parallelism.
+
+   run() divides a range of task indexes into contiguous blocks (one block per thread), and
+   returns when all tasks have been executed.  The calling thread executes the first block
+   itself, so a pool of N threads only starts (N - 1) worker threads.  Because the division of
+   tasks among threads only depends on the number of tasks and the number of threads, each
+   thread always sees the same tasks in the same order, which lets callers reduce per-thread
+   results deterministically.
+
+   \ingroup lut
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ThreadPool
+{
+public:
+    /**
+       A task function.
+       \param taskIdx task index
+       \param threadIdx index of executing thread (in [0, numThreads()))
+    */
+    using task_func_t = std::function<void(uint_t taskIdx, uint_t threadIdx)>;
+
+public:
+    /**
+       Constructor.
+       \param numThreads number of threads (including the calling thread)
+    */
+    ThreadPool(uint_t numThreads);
+
+    /** Destructor. */
+    ~ThreadPool();
+
+    /** Get the number of threads (including the calling thread). */
+    uint_t
+    numThreads() const
+    {
+        return _numThreads;
+    }
+
+    /** Get the CPU time used by the worker threads (in seconds, excluding the calling thread). */
+    double cpuTime() const;
+
+    /**
+       Execute tasks [0, numTasks) and wait for all of them to complete.
+       If a task throws an exception, the first such exception is re-thrown by run().
+       \param numTasks number of tasks
+       \param func task function
+    */
+    void run(uint_t numTasks, const task_func_t& func);
+
+private:
+    void work(uint_t threadIdx);
+    void runBlock(uint_t threadIdx);
+
+private:
+    uint_t _numThreads;
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _startCV;
+    std::condition_variable _doneCV;
+    const task_func_t* _func;
+    uint_t _numTasks;
+    uint_t _generation;
+    uint_t _numBusy;
+    bool _stop;
+    std::exception_ptr _exception;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LUT_NS_END;
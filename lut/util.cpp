@@ -156,11 +156,26 @@ time_date(time_t t)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+time_t
+time_midnight(time_t t)
+{
+    struct tm tms;
+    localtime_r(&t, &tms);
+    tms.tm_hour = 0;
+    tms.tm_min = 0;
+    tms.tm_sec = 0;
+    tms.tm_isdst = -1;
+    return mktime(&tms);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 uint_t
 time_timeOfDay(time_t t)
 {
-    struct tm* tms = localtime(&t);
-    return (tms->tm_hour * 3600) + (tms->tm_min * 60) + tms->tm_sec;
+    struct tm tms;
+    localtime_r(&t, &tms);
+    return (tms.tm_hour * 3600) + (tms.tm_min * 60) + tms.tm_sec;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,8 +183,9 @@ time_timeOfDay(time_t t)
 uint_t
 time_dayOfWeek(time_t t)
 {
-    struct tm* tms = localtime(&t);
-    return tms->tm_wday;
+    struct tm tms;
+    localtime_r(&t, &tms);
+    return tms.tm_wday;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,10 +193,11 @@ time_dayOfWeek(time_t t)
 std::string
 time_str(time_t t)
 {
-    auto tm = localtime(&t);
+    struct tm tms;
+    localtime_r(&t, &tms);
     char buf[128];
-    sprintf(buf, "%02u-%02u-%02u %02u:%02u:%02u", tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday,
-            tm->tm_hour, tm->tm_min, tm->tm_sec);
+    sprintf(buf, "%02u-%02u-%02u %02u:%02u:%02u", tms.tm_year + 1900, tms.tm_mon + 1, tms.tm_mday,
+            tms.tm_hour, tms.tm_min, tms.tm_sec);
     return std::string(buf);
 }
 
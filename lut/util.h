@@ -90,6 +90,21 @@ public:
     }
 };
 
+/**
+   Combine a 64-bit hash with a value.
+   \return combined hash
+   \param hash hash of previous values
+   \param val value to add to the hash
+   \ingroup lut
+*/
+inline uint64_t
+hashCombine(uint64_t hash, uint64_t val)
+{
+    val *= 0xff51afd7ed558ccdULL;
+    val ^= (val >> 33);
+    return hash ^ (val + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+}
+
 /**
    Order objects by their compare() method.
    \see utl::Object::compare
@@ -363,6 +378,15 @@ period_t periodFromString(const std::string& str);
 */
 time_t time_date(time_t tt);
 
+/**
+   Get local midnight at the start of the day for a given time.
+   Unlike time_date(), the result is correct on days that have a daylight-saving change.
+   \return time_t value for local midnight on the day of time tt
+   \param tt input time
+   \ingroup lut
+*/
+time_t time_midnight(time_t tt);
+
 /**
    Get number of seconds since start of day for given time.
    \return number of seconds since start of the day at time t